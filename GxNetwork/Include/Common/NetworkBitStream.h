@@ -0,0 +1,128 @@
+#pragma once
+
+#include "NetworkStream.h"
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FBitOStream class. Bit-granular writer on top of byte output stream, bits are packed LSB first.
+ * Pending bits are written to the underlying stream (zero padded to the byte boundary) on Flush() or destruction.
+ */
+class GX_NETWORK_EXPORT FBitOStream
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 * @param stream - underlying output stream.
+	 */
+	FBitOStream(FOStream& stream);
+
+	/**
+	 * @brief Destructor. Flushes pending bits.
+	 */
+	virtual ~FBitOStream();
+
+	/**
+	 * @brief Write bits.
+	 * @param value - value, only low bitsCount bits are written.
+	 * @param bitsCount - bits count (0..32).
+	 */
+	void WriteBits(uint32_t value, uint32_t bitsCount);
+
+	/**
+	 * @brief Write single bit.
+	 * @param value - value.
+	 */
+	void WriteBool(bool value);
+
+	/**
+	 * @brief Write variable length unsigned integer: groups of groupBits bits, each followed by continuation bit.
+	 * @param value - value.
+	 * @param groupBits - bits count per group (1..31).
+	 */
+	void WriteVarUInt(uint32_t value, uint32_t groupBits = 7);
+
+	/**
+	 * @brief Write pending bits to the underlying stream padding the last byte with zeros.
+	 */
+	void Flush();
+
+	/**
+	 * @brief Get count of bits written.
+	 * @return bits count.
+	 */
+	uint32_t GetBitsCount() const;
+
+private:
+
+	FOStream& _stream;
+	uint64_t _scratch = 0;
+	uint32_t _scratchBits = 0;
+	uint32_t _bitsCount = 0;
+
+};
+
+/**
+ * @brief FBitIStream class. Bit-granular reader on top of byte input stream, bytes are consumed on demand.
+ */
+class GX_NETWORK_EXPORT FBitIStream
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 * @param stream - underlying input stream.
+	 */
+	FBitIStream(FIStream& stream);
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FBitIStream();
+
+	/**
+	 * @brief Read bits.
+	 * @param bitsCount - bits count (0..32).
+	 * @return value.
+	 */
+	uint32_t ReadBits(uint32_t bitsCount);
+
+	/**
+	 * @brief Read single bit.
+	 * @return value.
+	 */
+	bool ReadBool();
+
+	/**
+	 * @brief Read variable length unsigned integer (see FBitOStream::WriteVarUInt()).
+	 * @param groupBits - bits count per group (1..31).
+	 * @return value.
+	 */
+	uint32_t ReadVarUInt(uint32_t groupBits = 7);
+
+	/**
+	 * @brief Drop the rest bits of the current byte.
+	 */
+	void Align();
+
+	/**
+	 * @brief Get count of bits read.
+	 * @return bits count.
+	 */
+	uint32_t GetBitsCount() const;
+
+private:
+
+	FIStream& _stream;
+	uint64_t _scratch = 0;
+	uint32_t _scratchBits = 0;
+	uint32_t _bitsCount = 0;
+
+};
+
+}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Network.h"
+#include "NetworkBufferPool.h"
 
 #include <mutex>
 #include <vector>
@@ -17,10 +18,17 @@ class GX_NETWORK_EXPORT FBuffer
 public:
 	
 	/**
-	 * @brief Constructor.
+	 * @brief Constructor. Storage is drawn from the default buffer pool.
 	 * @param c - buffer capacity.
 	 */
 	FBuffer(uint32_t c = 0);
+
+	/**
+	 * @brief Constructor.
+	 * @param pool - buffer pool storage is drawn from (should outlive the buffer).
+	 * @param c - buffer capacity.
+	 */
+	FBuffer(FBufferPool& pool, uint32_t c = 0);
 	
 	/**
 	 * @brief Destructor.
@@ -96,7 +104,7 @@ public:
 private:
 	
 	mutable std::mutex _mutex;
-	std::vector<uint8_t> _data;	
+	std::vector<uint8_t, FBufferAllocator<uint8_t>> _data;
 
 };
 
@@ -105,6 +113,65 @@ private:
  */
 typedef std::shared_ptr<FBuffer> FBufferPtr;
 
+/**
+ * @brief Immutable FBuffer shared pointer class decl.
+ */
+typedef std::shared_ptr<const FBuffer> FConstBufferPtr;
+
+/**
+ * @brief FBufferView class. Non-owning view of contiguous bytes (whole buffer or its sub-range).
+ * Viewed data should outlive the view.
+ */
+class GX_NETWORK_EXPORT FBufferView
+{
+
+public:
+
+	/**
+	 * @brief Constructor (empty view).
+	 */
+	FBufferView();
+
+	/**
+	 * @brief Constructor.
+	 * @param data - data pointer.
+	 * @param size - data size.
+	 */
+	FBufferView(const uint8_t* data, uint32_t size);
+
+	/**
+	 * @brief Constructor (view of the whole buffer).
+	 * @param buffer - buffer.
+	 */
+	FBufferView(const FBuffer& buffer);
+
+	/**
+	 * @brief Get view data pointer.
+	 * @return view data pointer.
+	 */
+	const uint8_t* Data() const;
+
+	/**
+	 * @brief Get size of view.
+	 * @return size of view.
+	 */
+	uint32_t Size() const;
+
+	/**
+	 * @brief Get sub-range of view.
+	 * @param offset - sub-range offset.
+	 * @param size - sub-range size.
+	 * @return sub-range view.
+	 */
+	FBufferView SubView(uint32_t offset, uint32_t size) const;
+
+private:
+
+	const uint8_t* _data;
+	uint32_t _size;
+
+};
+
 }	
 }
 
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Network.h"
+
+#include <mutex>
+#include <vector>
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FBufferPool class. Size-classed block allocator for buffer storage.
+ * Blocks are rounded up to power of two size classes, freed blocks are kept for reuse.
+ * Default pool additionally keeps thread-local caches, so allocation on hot paths takes no lock.
+ */
+class GX_NETWORK_EXPORT FBufferPool
+{
+
+public:
+
+	enum : uint32_t
+	{
+		MinBlockSizeLog2 = 6,
+		MaxBlockSizeLog2 = 20,
+		SizeClassesCount = MaxBlockSizeLog2 - MinBlockSizeLog2 + 1,
+		MaxCachedBytesPerSizeClass = 4 * 1024 * 1024,
+	};
+
+	/**
+	 * @brief Constructor.
+	 */
+	FBufferPool();
+
+	/**
+	 * @brief Destructor. Blocks still in use should not be returned after destruction.
+	 */
+	virtual ~FBufferPool();
+
+	FBufferPool(const FBufferPool&) = delete;
+	FBufferPool& operator=(const FBufferPool&) = delete;
+
+	/**
+	 * @brief Allocate block.
+	 * @param size - block size.
+	 * @return block pointer.
+	 */
+	void* Allocate(size_t size);
+
+	/**
+	 * @brief Return block to the pool.
+	 * @param block - block pointer.
+	 * @param size - block size (the same as on allocation).
+	 */
+	void Deallocate(void* block, size_t size);
+
+	/**
+	 * @brief Release all cached blocks of the calling thread and the pool.
+	 */
+	void Trim();
+
+	/**
+	 * @brief Get default pool (lives till process exit).
+	 * @return default pool.
+	 */
+	static FBufferPool& GetDefault();
+
+private:
+
+	struct FThreadCache;
+
+	static uint32_t GetSizeClass(size_t size);
+	static size_t GetBlockSize(uint32_t sizeClass);
+
+	FThreadCache* GetThreadCache();
+
+	void* AllocateShared(uint32_t sizeClass);
+	void DeallocateShared(void* block, uint32_t sizeClass);
+
+	std::mutex _mutex;
+	std::vector<void*> _blocks[SizeClassesCount];
+
+	bool _bThreadCache = false;
+
+};
+
+/**
+ * @brief FBufferAllocator class. Standard allocator adaptor over FBufferPool.
+ */
+template <class T>
+class FBufferAllocator
+{
+
+public:
+
+	typedef T value_type;
+
+	/**
+	 * @brief Constructor.
+	 * @param pool - buffer pool.
+	 */
+	FBufferAllocator(FBufferPool& pool = FBufferPool::GetDefault())
+		: _pool(&pool)
+	{
+	}
+
+	/**
+	 * @brief Constructor.
+	 * @param allocator - prototype.
+	 */
+	template <class U>
+	FBufferAllocator(const FBufferAllocator<U>& allocator)
+		: _pool(&allocator.GetPool())
+	{
+	}
+
+	/**
+	 * @brief Allocate elements.
+	 * @param n - elements count.
+	 * @return elements pointer.
+	 */
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(_pool->Allocate(n * sizeof(T)));
+	}
+
+	/**
+	 * @brief Deallocate elements.
+	 * @param p - elements pointer.
+	 * @param n - elements count.
+	 */
+	void deallocate(T* p, size_t n)
+	{
+		_pool->Deallocate(p, n * sizeof(T));
+	}
+
+	/**
+	 * @brief Get buffer pool.
+	 * @return buffer pool.
+	 */
+	FBufferPool& GetPool() const
+	{
+		return *_pool;
+	}
+
+private:
+
+	FBufferPool* _pool;
+
+};
+
+template <class T, class U>
+bool operator==(const FBufferAllocator<T>& a, const FBufferAllocator<U>& b)
+{
+	return &a.GetPool() == &b.GetPool();
+}
+
+template <class T, class U>
+bool operator!=(const FBufferAllocator<T>& a, const FBufferAllocator<U>& b)
+{
+	return &a.GetPool() != &b.GetPool();
+}
+
+}
+}
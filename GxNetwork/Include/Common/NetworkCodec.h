@@ -0,0 +1,140 @@
+#pragma once
+
+#include "NetworkBuffer.h"
+
+#include <memory>
+#include <vector>
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief ECodec enum. Frame codec identifier, sent with compressed frames.
+ */
+enum class ECodec : uint8_t
+{
+	None = 0,
+	LZ,
+	LZDictionary,
+
+	MaxValue,
+};
+
+/**
+ * @brief FCodec class. Frame compression codec interface.
+ */
+class GX_NETWORK_EXPORT FCodec
+{
+
+public:
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FCodec();
+
+	/**
+	 * @brief Get codec identifier.
+	 * @return codec identifier.
+	 */
+	virtual ECodec GetType() const = 0;
+
+	/**
+	 * @brief Compress data.
+	 * @param input - uncompressed data.
+	 * @param output - compressed data (overwritten).
+	 * @return true on success, false - otherwise.
+	 */
+	virtual bool Compress(const FBufferView& input, FBuffer& output) const = 0;
+
+	/**
+	 * @brief Decompress data.
+	 * @param input - compressed data.
+	 * @param size - uncompressed data size.
+	 * @param output - uncompressed data (overwritten).
+	 * @return true on success, false - data is malformed.
+	 */
+	virtual bool Decompress(const FBufferView& input, uint32_t size, FBuffer& output) const = 0;
+
+};
+
+/**
+ * @brief FCodec class shared pointer decl.
+ */
+typedef std::shared_ptr<FCodec> FCodecPtr;
+
+/**
+ * @brief FLZCodec class. Fast byte-oriented LZ77 codec (LZ4-like sequences of literals and matches, 64KB window).
+ * Optional static dictionary is treated as data preceding every frame, so repeated class, property and type data
+ * of small frames is matched against it. Both sides should use the same dictionary (see TrainDictionary()).
+ */
+class GX_NETWORK_EXPORT FLZCodec : public FCodec
+{
+
+public:
+
+	/**
+	 * @brief Constructor. Codec without dictionary (ECodec::LZ).
+	 */
+	FLZCodec();
+
+	/**
+	 * @brief Constructor. Codec with static dictionary (ECodec::LZDictionary), only the last 64KB of dictionary are used.
+	 * @param dictionary - dictionary data (copied).
+	 */
+	FLZCodec(const FBufferView& dictionary);
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FLZCodec();
+
+	/**
+	 * @brief See FCodec::GetType().
+	 */
+	virtual ECodec GetType() const override;
+
+	/**
+	 * @brief See FCodec::Compress().
+	 */
+	virtual bool Compress(const FBufferView& input, FBuffer& output) const override;
+
+	/**
+	 * @brief See FCodec::Decompress().
+	 */
+	virtual bool Decompress(const FBufferView& input, uint32_t size, FBuffer& output) const override;
+
+	/**
+	 * @brief Train dictionary offline on captured frames (e.g. FEngine::Replicate() output).
+	 * Segments made of byte sequences shared by the most samples are picked greedily.
+	 * @param samples - sample frames.
+	 * @param dictionarySize - maximal dictionary size.
+	 * @param dictionary - trained dictionary (overwritten).
+	 */
+	static void TrainDictionary(const std::vector<FBufferView>& samples, uint32_t dictionarySize, FBuffer& dictionary);
+
+private:
+
+	enum : uint32_t
+	{
+		MinMatchSize = 4,
+		MaxOffset = 0xFFFF,
+		MaxExpansion = 255,
+		HashBits = 12,
+	};
+
+	const uint8_t* At(const uint8_t* data, uint32_t pos) const;
+
+	static uint32_t Hash(const uint8_t* data);
+	static uint8_t* WriteLength(uint8_t* output, uint32_t length);
+	static bool ReadLength(const uint8_t*& input, const uint8_t* end, uint32_t& length);
+
+	std::vector<uint8_t> _dictionary;
+	// Hash table of dictionary positions, copied as initial state of every compression.
+	std::vector<uint32_t> _dictionaryTable;
+	uint32_t _dictionaryID;
+
+};
+
+}
+}
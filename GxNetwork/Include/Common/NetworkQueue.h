@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Network.h"
+
+#include <atomic>
+#include <utility>
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FLockFreeQueue class. Intrusive multi-producer single-consumer queue (Vyukov).
+ * Push may be called from any thread, Pop - from the single consumer thread only.
+ */
+template <class T>
+class FLockFreeQueue
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 */
+	FLockFreeQueue()
+		: _head(new FNode())
+		, _tail(_head.load(std::memory_order_relaxed))
+	{
+	}
+
+	FLockFreeQueue(const FLockFreeQueue&) = delete;
+	FLockFreeQueue& operator=(const FLockFreeQueue&) = delete;
+
+	/**
+	 * @brief Destructor.
+	 */
+	~FLockFreeQueue()
+	{
+		T value;
+		while (Pop(value))
+		{
+		}
+		delete _tail;
+	}
+
+	/**
+	 * @brief Push value (wait-free for producers).
+	 * @param value - value.
+	 */
+	void Push(T value)
+	{
+		FNode* node = new FNode(std::move(value));
+		FNode* prev = _head.exchange(node, std::memory_order_acq_rel);
+		prev->Next.store(node, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Pop value. Value pushed but not linked yet is left for the next call.
+	 * @param value - [out] value.
+	 * @return true on success, false - queue is empty.
+	 */
+	bool Pop(T& value)
+	{
+		FNode* tail = _tail;
+		FNode* next = tail->Next.load(std::memory_order_acquire);
+		if (!next)
+			return false;
+		value = std::move(next->Value);
+		_tail = next;
+		delete tail;
+		return true;
+	}
+
+	/**
+	 * @brief Check if queue is empty (consumer thread only).
+	 * @return true if queue is empty, false - otherwise.
+	 */
+	bool IsEmpty() const
+	{
+		return _tail->Next.load(std::memory_order_acquire) == nullptr;
+	}
+
+private:
+
+	struct FNode
+	{
+		FNode()
+			: Next(nullptr)
+		{
+		}
+
+		explicit FNode(T&& value)
+			: Value(std::move(value))
+			, Next(nullptr)
+		{
+		}
+
+		T Value;
+		std::atomic<FNode*> Next;
+	};
+
+	std::atomic<FNode*> _head;
+	FNode* _tail;
+
+};
+
+}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "NetworkTypes.h"
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FPropertySchema struct.
+ */
+struct GX_NETWORK_EXPORT FPropertySchema
+{
+	std::string Name;
+	uint8_t Type = 0;
+	uint8_t ElementType = 0;
+	uint8_t Encoding = 0;
+};
+
+/**
+ * @brief Deserialize FPropertySchema object.
+ * @param stream - input stream.
+ * @param propertySchema - object reference.
+ * @return stream reference.
+ */
+GX_NETWORK_EXPORT FIStream& operator>>(FIStream& stream, FPropertySchema& propertySchema);
+
+/**
+ * @brief Serialize FPropertySchema object.
+ * @param stream - output stream.
+ * @param propertySchema - object reference.
+ * @return stream reference.
+ */
+GX_NETWORK_EXPORT FOStream& operator<<(FOStream& stream, const FPropertySchema& propertySchema);
+
+/**
+ * @brief FClassSchema struct. Properties are stored in slot order, slot index is used as property ID on the wire.
+ * Classes are sent ordered by class ID.
+ */
+struct GX_NETWORK_EXPORT FClassSchema
+{
+	std::string ClassName;
+	std::vector<FPropertySchema> Properties;
+};
+
+/**
+ * @brief Deserialize FClassSchema object.
+ * @param stream - input stream.
+ * @param classSchema - object reference.
+ * @return stream reference.
+ */
+GX_NETWORK_EXPORT FIStream& operator>>(FIStream& stream, FClassSchema& classSchema);
+
+/**
+ * @brief Serialize FClassSchema object.
+ * @param stream - output stream.
+ * @param classSchema - object reference.
+ * @return stream reference.
+ */
+GX_NETWORK_EXPORT FOStream& operator<<(FOStream& stream, const FClassSchema& classSchema);
+
+/**
+ * @brief FClassSchemaMapping struct. Maps remote class to local class ID and remote property IDs to local property slots.
+ */
+struct GX_NETWORK_EXPORT FClassSchemaMapping
+{
+	enum { InvalidPropertyID = 0xFF, InvalidClassID = 0xFFFF };
+
+	uint16_t ClassID = InvalidClassID;
+	std::vector<uint8_t> Properties;
+};
+
+}
+}
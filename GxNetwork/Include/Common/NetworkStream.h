@@ -49,6 +49,12 @@ public:
 	 * @param buffer - data storage.
 	 */
 	FIStream(const FBuffer& buffer);
+
+	/**
+	 * @brief Constructor. Data is read in place, no copy is made.
+	 * @param view - data view.
+	 */
+	FIStream(const FBufferView& view);
 	
 	/**
 	 * @brief Destructor.
@@ -60,6 +66,12 @@ public:
 	 * @return true if stream is in EOF state, false - otherwise.
 	 */
 	bool IsEOF() const;
+
+	/**
+	 * @brief Get size of data left to read.
+	 * @return data size in bytes.
+	 */
+	uint32_t Remaining() const;
 	
 	/**
 	 * @brief Read chunk of data.
@@ -67,6 +79,12 @@ public:
 	 * @return data const pointer.
 	 */
 	const uint8_t* Read(uint32_t size);
+
+	/**
+	 * @brief Read variable length unsigned integer (see FOStream::WriteVarUInt()).
+	 * @return value.
+	 */
+	uint32_t ReadVarUInt();
 	
 	/**
 	 * @brief Read data into value.
@@ -82,7 +100,7 @@ public:
 	
 private:
 	
-	const FBuffer& _buffer;
+	FBufferView _view;
 
 };
 
@@ -111,6 +129,33 @@ public:
 	 * @param data - data const pointer.
 	 */
 	void Write(const uint8_t* data, uint32_t size);
+
+	/**
+	 * @brief Drop data written after the given position and move stream position there.
+	 * @param pos - new data end position.
+	 */
+	void Truncate(uint32_t pos);
+
+	/**
+	 * @brief Write variable length unsigned integer: 7 bits per byte, high bit marks continuation (1..5 bytes).
+	 * @param value - value.
+	 */
+	void WriteVarUInt(uint32_t value);
+
+	/**
+	 * @brief Reserve variable length size prefix at the current position, should be followed by CommitSize() after the payload is written.
+	 * @param sizeHint - expected payload size, prefix is reserved wide enough for it (e.g. size of the previous payload of the same block).
+	 * @return reserved prefix position.
+	 */
+	uint32_t ReserveSize(uint32_t sizeHint = 0);
+
+	/**
+	 * @brief Write size of the payload written since ReserveSize() into the reserved prefix in place.
+	 * Smaller size is padded to the reserved width, larger one gets the prefix widened by shifting the payload once.
+	 * @param sizePos - reserved prefix position.
+	 * @return payload size.
+	 */
+	uint32_t CommitSize(uint32_t sizePos);
 	
 	/**
 	 * @brief Read data into value.
@@ -124,8 +169,15 @@ public:
 		return *this;
 	}
 	
+	/**
+	 * @brief Maximal size of variable length unsigned integer.
+	 */
+	enum : uint32_t { MaxVarUIntSize = 5 };
+
 private:
 
+	static uint32_t EncodeVarUInt(uint32_t value, uint8_t* data);
+
 	FBuffer& _buffer;
 	
 };
@@ -146,6 +146,71 @@ GX_NETWORK_EXPORT FIStream& operator>>(FIStream& stream, FGuid& GUID);
  */
 GX_NETWORK_EXPORT FOStream& operator<<(FOStream& stream, const FGuid& GUID);
 
+/**
+ * @brief FObjectHandle struct. Generational object handle: slot index in the low bits, slot generation in the high bits.
+ * Handle of the destroyed object becomes stale once its slot is reused with the next generation.
+ */
+struct GX_NETWORK_EXPORT FObjectHandle
+{
+	enum : uint32_t
+	{
+		IndexBits = 20,
+		IndexMask = (1u << IndexBits) - 1,
+		GenerationBits = 11,
+		GenerationMask = (1u << GenerationBits) - 1,
+		MaxValue = (GenerationMask << IndexBits) | IndexMask,
+		InvalidValue = 0
+	};
+
+	/**
+	 * @brief Constructor.
+	 */
+	FObjectHandle();
+
+	/**
+	 * @brief Constructor.
+	 * @param index - slot index.
+	 * @param generation - slot generation, never 0 for valid handle.
+	 */
+	FObjectHandle(uint32_t index, uint32_t generation);
+
+	/**
+	 * @brief Get slot index.
+	 * @return slot index.
+	 */
+	uint32_t GetIndex() const;
+
+	/**
+	 * @brief Get slot generation.
+	 * @return slot generation.
+	 */
+	uint32_t GetGeneration() const;
+
+	/**
+	 * @brief Check if handle is valid.
+	 * @return true if handle is valid, false - otherwise.
+	 */
+	bool IsValid() const;
+
+	uint32_t Value;
+};
+
+/**
+ * @brief FObjectHandle equal operator.
+ * @param a - first value.
+ * @param b - second value.
+ * @return true if values are equal, false - otherwise.
+ */
+GX_NETWORK_EXPORT bool operator==(const FObjectHandle& a, const FObjectHandle& b);
+
+/**
+ * @brief FObjectHandle notequal operator.
+ * @param a - first value.
+ * @param b - second value.
+ * @return true if values are not equal, false - otherwise.
+ */
+GX_NETWORK_EXPORT bool operator!=(const FObjectHandle& a, const FObjectHandle& b);
+
 /**
  * @brief FHeader struct.
  */
@@ -179,6 +244,68 @@ GX_NETWORK_EXPORT FIStream& operator>>(FIStream& stream, FHeader& header);
  */
 GX_NETWORK_EXPORT FOStream& operator<<(FOStream& stream, const FHeader& header);
 
+/**
+ * @brief FStringView class. Non-owning view of NUL-terminated string, e.g. string decoded in place from the received frame.
+ * Viewed data should outlive the view.
+ */
+class GX_NETWORK_EXPORT FStringView
+{
+
+public:
+
+	/**
+	 * @brief Constructor (empty string).
+	 */
+	FStringView();
+
+	/**
+	 * @brief Constructor.
+	 * @param string - NUL-terminated string.
+	 */
+	FStringView(const char* string);
+
+	/**
+	 * @brief Constructor.
+	 * @param string - NUL-terminated string.
+	 * @param size - string size without terminator.
+	 */
+	FStringView(const char* string, uint32_t size);
+
+	/**
+	 * @brief Get NUL-terminated string pointer.
+	 * @return string pointer.
+	 */
+	const char* Data() const;
+
+	/**
+	 * @brief Get string size without terminator.
+	 * @return string size.
+	 */
+	uint32_t Size() const;
+
+private:
+
+	const char* _data;
+	uint32_t _size;
+
+};
+
+/**
+ * @brief Deserialize FStringView object. String is not copied, view points into the stream data.
+ * @param stream - input stream.
+ * @param string - object reference.
+ * @return stream reference.
+ */
+GX_NETWORK_EXPORT FIStream& operator>>(FIStream& stream, FStringView& string);
+
+/**
+ * @brief Serialize FStringView object (the same layout as std::string).
+ * @param stream - output stream.
+ * @param string - object reference.
+ * @return stream reference.
+ */
+GX_NETWORK_EXPORT FOStream& operator<<(FOStream& stream, const FStringView& string);
+
 /**
 * @brief Deserialize std::string object.
 * @param stream - input stream.
@@ -205,8 +332,7 @@ template <class T>
 FIStream& operator>>(FIStream& stream, std::vector<T>& vector)
 {
 	static_assert(std::is_integral<T>::value == true, "Only integral types are accepted.");
-	uint32_t  size = 0;
-	stream >> size;
+	uint32_t  size = stream.ReadVarUInt();
 	vector.resize(size / sizeof(T));
 	memcpy(vector.data(), stream.Read(size), size);
 	return stream;
@@ -223,7 +349,7 @@ FOStream& operator<<(FOStream& stream, const std::vector<T>& vector)
 {
 	static_assert(std::is_integral<T>::value == true, "Only integral types are accepted.");
 	uint32_t  size = GX_NETWORK_SIZE_T_TO_UINT_32_T(vector.size() * sizeof(T));
-	stream << size;
+	stream.WriteVarUInt(size);
 	stream.Write((const uint8_t*)(vector.data()), size);
 	return stream;
 }
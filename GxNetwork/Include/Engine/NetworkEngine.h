@@ -1,6 +1,9 @@
 #pragma once
 
 #include "NetworkObject.h"
+#include "NetworkObjectTable.h"
+#include "NetworkRelevancy.h"
+#include "NetworkSpatialGrid.h"
 
 #include <map>
 #include <string>
@@ -18,6 +21,16 @@ class FManager;
  */
 typedef std::shared_ptr<FManager> FManagerPtr;
 
+/**
+ * @brief FRemoteEngine class forward decl.
+ */
+class FRemoteEngine;
+
+/**
+ * @brief FRemoteEngine class shared pointer forward decl.
+ */
+typedef std::shared_ptr<FRemoteEngine> FRemoteEnginePtr;
+
 /**
  * @brief FEngine class.
  */
@@ -26,6 +39,11 @@ class GX_NETWORK_EXPORT FEngine
 
 public:
 
+	enum : uint32_t
+	{
+		DefaultPropertyChunksBudget = 32 * 1024,
+	};
+
 	/**
 	 * @brief FEngine::EMode enum.
 	 */
@@ -34,6 +52,15 @@ public:
 		Client,
 		Server,
 	};
+
+	/**
+	 * @brief FEngine::EReplicationMode enum.
+	 */
+	enum EReplicationMode
+	{
+		Full,		//<! every tick all objects are serialized into the shared engine replication frame.
+		Delta,		//<! every tick each remote engine gets own frame with changes after its acknowledged frame.
+	};
 	
 	/**
 	 * @brief Constructor.
@@ -77,11 +104,68 @@ public:
 	 */
 	FManagerPtr GetNetworkManager() const;
 
+	/**
+	 * @brief Set replication mode.
+	 * @param replicationMode - replication mode.
+	 */
+	void SetReplicationMode(EReplicationMode replicationMode);
+
+	/**
+	 * @brief Get replication mode.
+	 * @return replication mode.
+	 */
+	EReplicationMode GetReplicationMode() const;
+
+	/**
+	 * @brief Set relevancy policy filtering objects of remote engine replication frames (delta replication mode only).
+	 * @param relevancyPolicy - relevancy policy (nullptr - every object is relevant).
+	 */
+	void SetRelevancyPolicy(const FRelevancyPolicyPtr& relevancyPolicy);
+
+	/**
+	 * @brief Get relevancy policy.
+	 * @return relevancy policy on success, nullptr - otherwise.
+	 */
+	const FRelevancyPolicyPtr& GetRelevancyPolicy() const;
+
+	/**
+	 * @brief Set byte budget of remote engine replication frame (delta replication mode only).
+	 * Objects are sent in order of priority accumulated while they wait, objects not fitting the budget are deferred to next frames.
+	 * @param replicationBudget - frame size in bytes (0 - unlimited).
+	 */
+	void SetReplicationBudget(uint32_t replicationBudget);
+
+	/**
+	 * @brief Get byte budget of remote engine replication frame.
+	 * @return frame size in bytes (0 - unlimited).
+	 */
+	uint32_t GetReplicationBudget() const;
+
+	/**
+	 * @brief Set chunks byte budget of remote engine replication frame (delta replication mode only).
+	 * Properties with revision data larger than FProperty::ChunkSize are sent in chunks, only changed chunks are sent again.
+	 * @param propertyChunksBudget - chunks data size in bytes.
+	 */
+	void SetPropertyChunksBudget(uint32_t propertyChunksBudget);
+
+	/**
+	 * @brief Get chunks byte budget of remote engine replication frame.
+	 * @return chunks data size in bytes.
+	 */
+	uint32_t GetPropertyChunksBudget() const;
+
 	/**
 	 * @brief Replicate engine state (deserialize).
 	 * @param stream - input stream.
 	 */
 	void Replicate(FIStream& stream);
+
+	/**
+	 * @brief Replicate engine state (deserialize).
+	 * @param stream - input stream.
+	 * @param remoteEngine - remote engine the frame was recieved from.
+	 */
+	void Replicate(FIStream& stream, const FRemoteEnginePtr& remoteEngine);
 	
 	/**
 	 * @brief Replicate engine state (serialize).
@@ -89,12 +173,27 @@ public:
 	 */
 	void Replicate(FOStream& stream) const;
 
+	/**
+	 * @brief Replicate engine state changed after the frame acknowledged by remote engine (serialize).
+	 * Objects with handles known by remote engine are sent without GUID.
+	 * @param stream - output stream.
+	 * @param remoteEngine - remote engine the frame is built for (nothing acknowledged - full snapshot).
+	 */
+	void Replicate(FOStream& stream, const FRemoteEnginePtr& remoteEngine) const;
+
 	/**
 	 * @brief Replicate engine events.
 	 * @param stream - input stream.
 	 */
 	void ReplicateEvents(FIStream& stream);
 
+	/**
+	 * @brief Replicate engine events.
+	 * @param stream - input stream.
+	 * @param remoteEngine - remote engine the events were recieved from.
+	 */
+	void ReplicateEvents(FIStream& stream, const FRemoteEnginePtr& remoteEngine);
+
 	/**
 	 * @brief Called while player joined game.
 	 * @param playerGUID - player GUID.
@@ -121,6 +220,12 @@ public:
 	 */
 	const FBuffer& GetReplicationFrame() const;
 
+	/**
+	 * @brief Get index of the last replication frame produced by engine.
+	 * @return replication frame index.
+	 */
+	uint32_t GetReplicationFrameIndex() const;
+
 	/**
 	 * @brief Get object by GUID.
 	 * @param GUID - object GUID.
@@ -128,6 +233,26 @@ public:
 	 */
 	FObjectPtr GetObjectByGUID(const FGuid& GUID) const;
 
+	/**
+	 * @brief Get object by handle.
+	 * @param handle - object handle.
+	 * @return object pointer on success, nullptr - handle is invalid or stale.
+	 */
+	FObjectPtr GetObjectByHandle(const FObjectHandle& handle) const;
+
+	/**
+	 * @brief Get spatial grid of object locations (maintained by objects themselves, e.g. FActor::SetLocation()).
+	 * Objects are removed from grid on removal from engine.
+	 * @return spatial grid reference.
+	 */
+	FSpatialGrid& GetSpatialGrid();
+
+	/**
+	 * @brief Get spatial grid of object locations.
+	 * @return spatial grid const reference.
+	 */
+	const FSpatialGrid& GetSpatialGrid() const;
+
 	/**
 	 * @brief Create object by class name.
 	 * @param GUID - object GUID.
@@ -136,6 +261,14 @@ public:
 	 */
 	FObjectPtr CreateObjectStatic(const FGuid& GUID, const char* className);
 
+	/**
+	 * @brief Find class ID by class name.
+	 * @param className - class name.
+	 * @param classID - class ID.
+	 * @return true on found, false - otherwise.
+	 */
+	bool FindClassID(const char* className, uint16_t& classID) const;
+
 	/**
 	 * @brief Remove object by GUID.
 	 * @param GUID - object GUID.
@@ -143,6 +276,12 @@ public:
 	 */
 	FObjectPtr RemoveObjectStatic(const FGuid& GUID);
 
+	/**
+	 * @brief Get local class schema (available after initialization).
+	 * @return classes schema.
+	 */
+	const std::vector<FClassSchema>& GetClassSchema() const;
+
 	/**
 	 * @brief Register class.
 	 * @param className - class name.
@@ -153,21 +292,40 @@ public:
 
 private:
 
+	enum : uint32_t { ObjectHandleBindingFlag = 1u << 31 };
+
 	bool CheckInitialized(const char* context = "") const;
 
-	FObjectPtr CreateObjectByClassName(const FGuid& GUID, const char* className, uint16_t role);
+	bool IsReplicated(const FObjectPtr& object) const;
+	bool IsRelevant(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) const;
+	float GetReplicationPriority(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) const;
+	bool IsDormancyAcknowledged(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) const;
+
+	void UpdateReplicationSchedule();
+	void UpdateReplicationRevisions();
+	void UpdateRelevancyCandidates();
+	void UpdateRemoteReplicationFrames();
+
+	const char* GetClassNameByID(uint16_t classID) const;
+
+	FObjectPtr CreateObjectByClassID(const FGuid& GUID, uint16_t classID, uint16_t role);
 	FObjectPtr RemoveObjectByGUID(const FGuid& GUID);
 
-	FObjectPtr CreateObjectDynamic(const FGuid& GUID, const FGuid& ownerGUID, const char* className);
+	FObjectPtr CreateObjectStaticByClassID(const FGuid& GUID, uint16_t classID);
+
+	FObjectPtr CreateObjectDynamic(const FGuid& GUID, const FGuid& ownerGUID, uint16_t classID);
 	FObjectPtr RemoveObjectDynamic(const FGuid& GUID);
 
-	bool ProcessEventExecFunctionRemote(const FGuid& GUID, const char* name, const FBuffer& parameters);
+	bool ProcessEventExecFunctionRemote(const FGuid& GUID, const char* name, const FBufferView& parameters);
 	void BroadcastEventExecFunctionRemote(const FGuid& GUID, const char* name, const FBuffer& parameters);
 
-	bool ProcessEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, const char* className);
+	void BuildClassSchema();
+	bool ProcessEventClassSchema(const std::vector<FClassSchema>& classes, const FRemoteEnginePtr& remoteEngine);
+
+	bool ProcessEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, uint16_t classID);
 	bool ProcessEventRemoveObject(const FGuid& GUID);
 
-	void BroadcastEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, const char* className);
+	void BroadcastEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, uint16_t classID);
 	void BroadcastEventRemoveObject(const FGuid& GUID);
 
 protected:
@@ -206,8 +364,24 @@ private:
 
 	bool _bInitialized = false;
 
+	EReplicationMode _replicationMode = EReplicationMode::Full;
+	FRelevancyPolicyPtr _relevancyPolicy;
+	uint32_t _replicationBudget = 0;
+	uint32_t _propertyChunksBudget = DefaultPropertyChunksBudget;
+
 	FBuffer _replicationFrame;
-	std::vector<FObjectPtr> _objects;
+	uint32_t _replicationFrameIndex = 0;
+	double _replicationTime = 0.0;
+	FBuffer _replicationScratch;
+
+	FObjectTable _objects;
+	FSpatialGrid _spatialGrid;
+	// Always relevant objects and objects missing in spatial grid, relevancy candidates of every remote engine.
+	std::vector<FObjectHandle> _unlocatedObjects;
+
+	std::vector<FClassSchema> _classSchema;
+	std::vector<FObject::FCreator> _classCreators;
+	std::map<std::string, uint16_t> _classIDs;
 
 protected:
 
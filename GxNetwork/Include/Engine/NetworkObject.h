@@ -3,7 +3,7 @@
 #include "NetworkReplicable.h"
 #include "NetworkProperty.h"
 #include "NetworkFunction.h"
-#include "../Common/NetworkTypes.h"
+#include "../Common/NetworkSchema.h"
 
 namespace gx {
 namespace network {
@@ -109,6 +109,42 @@ public:
 	 * @brief See FReplicable::operator>>(FOStream&).
 	 */
 	virtual void operator>>(FOStream& stream) const override;
+
+	/**
+	 * @brief Deserialize object using remote class schema mapping.
+	 * @param stream - input stream.
+	 * @param classSchemaMapping - remote property IDs mapping (nullptr - remote schema equals local one).
+	 */
+	void Replicate(FIStream& stream, const FClassSchemaMapping* classSchemaMapping);
+
+	/**
+	 * @brief Serialize properties changed since the last call only. Changes are tracked apart from dirty bits
+	 * used by engine replication, so calling it does not hide changes from delta replication frames.
+	 * @param stream - output stream.
+	 */
+	void ReplicateDirty(FOStream& stream);
+
+	/**
+	 * @brief Serialize properties changed after the given baseline frame.
+	 * @param stream - output stream.
+	 * @param baselineFrameIndex - replication frame index acknowledged by the remote side (0 - full object state).
+	 * @param chunkWriter - writer of chunked properties (nullptr - chunked properties are sent whole).
+	 */
+	void ReplicateDelta(FOStream& stream, uint32_t baselineFrameIndex, FPropertyChunkWriter* chunkWriter = nullptr) const;
+
+	/**
+	 * @brief Update revisions of dirty properties and clear dirty bits.
+	 * @param frameIndex - current replication frame index.
+	 * @param scratch - temporary buffer for serialization.
+	 * @return true if any property changed since the last update, false - otherwise.
+	 */
+	bool UpdateRevision(uint32_t frameIndex, FBuffer& scratch);
+
+	/**
+	 * @brief Get object revision (replication frame index of the last change).
+	 * @return object revision.
+	 */
+	uint32_t GetRevision() const;
 	
 	/**
 	 * @brief Get object class name.
@@ -116,6 +152,73 @@ public:
 	 */
 	virtual const char* GetClassName() const = 0;
 
+	/**
+	 * @brief Get object class ID (index of the class in engine class schema).
+	 * @return object class ID.
+	 */
+	uint16_t GetClassID() const;
+
+	/**
+	 * @brief Get object handle (valid while object is registered in engine).
+	 * @return object handle.
+	 */
+	const FObjectHandle& GetHandle() const;
+
+	/**
+	 * @brief Check if object is replicated to every remote engine regardless of relevancy policy (see FRelevancyPolicy).
+	 * @return true if object is always relevant, false - otherwise.
+	 */
+	virtual bool IsAlwaysRelevant() const;
+
+	/**
+	 * @brief Get base replication priority of object class, used when replication frame budget is limited.
+	 * @return replication priority (1 - default).
+	 */
+	virtual float GetReplicationPriority() const;
+
+	/**
+	 * @brief Get class replication frequency, may be overridden by derived classes for rarely changed objects.
+	 * @return replications per second (0 - every engine tick).
+	 */
+	virtual float GetClassReplicationFrequency() const;
+
+	/**
+	 * @brief Set object replication frequency (delta replication mode only), overrides class replication frequency.
+	 * @param frequency - replications per second (0 - every engine tick, negative - class replication frequency).
+	 */
+	void SetReplicationFrequency(float frequency);
+
+	/**
+	 * @brief Get object replication frequency. Changes made between replications are accumulated and sent together.
+	 * @return replications per second (0 - every engine tick).
+	 */
+	float GetReplicationFrequency() const;
+
+	/**
+	 * @brief Check if objects of the class are created dormant (see SetDormant()).
+	 * @return true if object is dormant after creation, false - otherwise.
+	 */
+	virtual bool IsInitiallyDormant() const;
+
+	/**
+	 * @brief Set object dormancy (delta replication mode). Dormant object is skipped by replication until
+	 * it is woken by property change or FlushDormancy(), remote engines keep its last replicated state.
+	 * @param bDormant - dormancy flag.
+	 */
+	void SetDormant(bool bDormant);
+
+	/**
+	 * @brief Check if object is dormant.
+	 * @return true if object is dormant, false - otherwise.
+	 */
+	bool IsDormant() const;
+
+	/**
+	 * @brief Wake dormant object for the next replication, all properties are checked for changes
+	 * (e.g. made without property setters). Object stays dormant after that.
+	 */
+	void FlushDormancy();
+
 	/**
 	 * @brief Static creator type decl.
 	 */
@@ -135,6 +238,19 @@ public:
 	 */
 	FProperty* GetProperty(const char* name);
 
+	/**
+	 * @brief Get properties count.
+	 * @return properties count.
+	 */
+	uint32_t GetPropertyCount() const;
+
+	/**
+	 * @brief Get property by slot index.
+	 * @param index - property slot index (property ID).
+	 * @return property object on success, nullptr - otherwise.
+	 */
+	FProperty* GetPropertyByIndex(uint32_t index) const;
+
 	/**
 	 * @brief Register object function.
 	 * @param name - function name.
@@ -151,6 +267,30 @@ public:
 	 */
 	bool RegisterProperty(const char* name, FProperty* property);
 
+	/**
+	 * @brief Mark property dirty by slot index.
+	 * @param index - property slot index.
+	 */
+	void MarkPropertyDirty(uint32_t index);
+
+	/**
+	 * @brief Check property dirty state by slot index.
+	 * @param index - property slot index.
+	 * @return true if property changed since the last serialization, false - otherwise.
+	 */
+	bool IsPropertyDirty(uint32_t index) const;
+
+	/**
+	 * @brief Check if any property is dirty.
+	 * @return true if any property changed since the last serialization, false - otherwise.
+	 */
+	bool IsDirty() const;
+
+	/**
+	 * @brief Clear dirty bits of all properties (changes are not serialized by ReplicateDirty() as well).
+	 */
+	void ClearDirtyProperties();
+
 	/**
 	 * @brief Exec function by name.
 	 * @param parameters - input parameters.
@@ -158,6 +298,13 @@ public:
 	 */
 	bool ExecFunction(const char* name, const FBuffer& parameters);
 
+	/**
+	 * @brief Exec function by name. Parameters are decoded in place.
+	 * @param parameters - input parameters view.
+	 * @return true - on success, false - otherwise.
+	 */
+	bool ExecFunction(const char* name, const FBufferView& parameters);
+
 	/**
 	 * @brief Exec remote function by name.
 	 * @param parameters - input parameters.
@@ -166,14 +313,50 @@ public:
 
 private:
 
+	// Property slot IDs are below it, so it marks chunks of property revision data.
+	enum : uint8_t { ChunksPropertyID = FClassSchemaMapping::InvalidPropertyID };
+
+	void SerializeProperty(FOStream& stream, const FProperty* property) const;
+
+	// Upper bounds of serialized properties data size, size prefixes are reserved for them.
+	uint32_t GetSizeHint(bool bUnsentOnly) const;
+	uint32_t GetDeltaSizeHint(uint32_t baselineFrameIndex, bool bChunks) const;
+	static uint32_t GetChunksSizeHint(const FProperty* property);
+
+private:
+
+	friend class FEngine;
+
 	FGuid _GUID;
 	uint16_t _role;
+	uint16_t _classID = FClassSchemaMapping::InvalidClassID;
+	FObjectHandle _handle;
+
+	uint32_t _revision = 0;
+
+	float _replicationFrequency = -1.0f;
+	double _nextReplicationTime = 0.0;
+	bool _bReplicationDue = true;
+	bool _bDormant = false;
 
 	std::map<std::string, FFunction*> _functions;
 	std::map<std::string, FProperty*> _properties;
 
+	std::vector<FProperty*> _propertySlots;
+	std::vector<bool> _dirtyProperties;
+	uint32_t _dirtyPropertiesCount = 0;
+
+	// Dirty bits of ReplicateDirty(), engine replication clears the ones above only.
+	std::vector<bool> _unsentProperties;
+	uint32_t _unsentPropertiesCount = 0;
+
 protected:
 
+	/**
+	 * @brief Callback, called after object properties were replicated from remote engine.
+	 */
+	virtual void OnReplicated();
+
 	FEngine* _engine = nullptr;
 
 };
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../Common/NetworkTypes.h"
+
+#include <vector>
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FObject class forward decl.
+ */
+class FObject;
+
+/**
+ * @brief FObject shared pointer class decl.
+ */
+typedef std::shared_ptr<FObject> FObjectPtr;
+
+/**
+ * @brief FObjectTable class. Objects are stored in dense array, open addressing hash index maps GUID to dense array position.
+ * Every stored object owns a generational handle slot, handle slot maps to dense array position too.
+ */
+class GX_NETWORK_EXPORT FObjectTable
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 */
+	FObjectTable();
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FObjectTable();
+
+	/**
+	 * @brief Find object by GUID.
+	 * @param GUID - object GUID.
+	 * @return object pointer on success, nullptr - otherwise.
+	 */
+	FObjectPtr Find(const FGuid& GUID) const;
+
+	/**
+	 * @brief Find object by handle.
+	 * @param handle - object handle.
+	 * @return object pointer on success, nullptr - handle is invalid or stale.
+	 */
+	FObjectPtr Find(const FObjectHandle& handle) const;
+
+	/**
+	 * @brief Insert object.
+	 * @param object - object pointer.
+	 * @param handle - [out] object handle.
+	 * @return true on inserted, false - object with the same GUID already exists.
+	 */
+	bool Insert(const FObjectPtr& object, FObjectHandle& handle);
+
+	/**
+	 * @brief Remove object by GUID. Object handle becomes stale. Last object takes place of the removed one in dense array.
+	 * @param GUID - object GUID.
+	 * @return removed object pointer on success, nullptr - otherwise.
+	 */
+	FObjectPtr Remove(const FGuid& GUID);
+
+	/**
+	 * @brief Remove all objects.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Get objects count.
+	 * @return objects count.
+	 */
+	uint32_t Size() const;
+
+	/**
+	 * @brief Get begin iterator of dense objects array.
+	 * @return begin iterator.
+	 */
+	std::vector<FObjectPtr>::const_iterator begin() const;
+
+	/**
+	 * @brief Get end iterator of dense objects array.
+	 * @return end iterator.
+	 */
+	std::vector<FObjectPtr>::const_iterator end() const;
+
+private:
+
+	enum { EmptySlot = 0xFFFFFFFF };
+
+	struct FHandleSlot
+	{
+		uint32_t Generation;
+		uint32_t Position;
+	};
+
+	static uint32_t Hash(const FGuid& GUID);
+
+	uint32_t FindSlot(const FGuid& GUID) const;
+	void Rehash(uint32_t capacity);
+
+	std::vector<uint32_t> _slots;
+	std::vector<FGuid> _keys;
+	std::vector<FObjectHandle> _handles;
+	std::vector<FObjectPtr> _objects;
+
+	std::vector<FHandleSlot> _handleSlots;
+	std::vector<uint32_t> _freeHandleSlots;
+
+};
+
+}
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../../Include/Common/NetworkTypes.h"
+#include "NetworkPropertyPacker.h"
+
+#include <vector>
+#include <utility>
 
 namespace gx {
 namespace network {
@@ -35,8 +39,19 @@ public:
 		Vector		= 9,	//<! std::vector<T>
 		Vec3f		= 10,	//<! gx::network::FVec3f
 		GUID		= 11,	//<! gx::network::FGuid
+		Bool		= 12,	//<! bool
 	};
 
+	/**
+	 * @brief Revision data larger than chunk size is sent in chunks (delta replication mode, see FPropertyChunkWriter).
+	 */
+	enum : uint32_t { ChunkSize = 4096 };
+
+	/**
+	 * @brief Maximal revision data size accepted from remote side in chunks, larger transfers are rejected as malformed.
+	 */
+	enum : uint32_t { MaxChunkedSize = 64 * 1024 * 1024 };
+
 	/**
 	 * @brief Constructor.
 	 * @param object - owner object.
@@ -50,12 +65,35 @@ public:
 	 */
 	virtual ~FProperty();
 
+	/**
+	 * @brief Get property name.
+	 * @return property name.
+	 */
+	const char* GetName() const;
+
 	/**
 	 * @brief Get property type.
 	 * @return property type.
 	 */
 	FProperty::EType GetType() const;
 
+	/**
+	 * @brief Get property encoding (packer used for serialization).
+	 * @return property encoding.
+	 */
+	virtual EPropertyEncoding GetEncoding() const = 0;
+
+	/**
+	 * @brief Get property slot index in owner object.
+	 * @return property slot index.
+	 */
+	uint32_t GetIndex() const;
+
+	/**
+	 * @brief Mark property as changed since the last serialization.
+	 */
+	void MarkDirty();
+
 	/**
 	 * @brief Deserialize property.
 	 * @param stream - input stream.
@@ -68,10 +106,64 @@ public:
 	 */
 	virtual void operator>>(FOStream& stream) const = 0;
 
+	/**
+	 * @brief Get property revision (replication frame index of the last change).
+	 * @return property revision.
+	 */
+	uint32_t GetRevision() const;
+
+	/**
+	 * @brief Get property data serialized at the last revision update.
+	 * @return serialized property data.
+	 */
+	const std::vector<uint8_t>& GetRevisionData() const;
+
+	/**
+	 * @brief Serialize property and compare it with the data of the last revision.
+	 * @param frameIndex - current replication frame index.
+	 * @param scratch - temporary buffer for serialization.
+	 * @return true if property changed since the last revision, false - otherwise.
+	 */
+	bool UpdateRevision(uint32_t frameIndex, FBuffer& scratch);
+
+	/**
+	 * @brief Check if property revision data is sent in chunks.
+	 * @return true if revision data is larger than chunk size, false - otherwise.
+	 */
+	bool IsChunked() const;
+
+	/**
+	 * @brief Get revisions of revision data chunks, only chunks changed by revision update get new revision.
+	 * @return chunk revisions (chunk per ChunkSize bytes of revision data).
+	 */
+	const std::vector<uint32_t>& GetChunkRevisions() const;
+
+	/**
+	 * @brief Deserialize revision data chunks (see FPropertyChunkWriter). Chunks are collected till the last one
+	 * of transfer is recieved, then property is deserialized from the collected revision data.
+	 * @param stream - input stream.
+	 * @return true on success, false - chunks are malformed.
+	 */
+	bool ReplicateChunks(FIStream& stream);
+
 private:
 
+	friend class FObject;
+
+	FObject* _object = nullptr;
+	const char* _name = nullptr;
+	uint32_t _index = 0;
+
 	EType _type;
 
+	uint32_t _revision = 0;
+	std::vector<uint8_t> _revisionData;
+	std::vector<uint32_t> _chunkRevisions;
+	// Revision data collected from recieved chunks.
+	std::vector<uint8_t> _chunksData;
+	// Size of the last whole serialized property data, the next size prefix is reserved for it.
+	mutable uint32_t _sizeHint = 0;
+
 protected:
 
 	template <class T>
@@ -157,6 +249,36 @@ protected:
 		static FProperty::EType Type() { return EType::GUID; }
 	};
 
+	template <>
+	struct FTypeToPropertyType <bool>
+	{
+		static FProperty::EType Type() { return EType::Bool; }
+	};
+
+};
+
+/**
+ * @brief FPropertyChunkWriter class. Writes chunks of large property revision data for remote engine
+ * (see FObject::ReplicateDelta()).
+ */
+class GX_NETWORK_EXPORT FPropertyChunkWriter
+{
+
+public:
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FPropertyChunkWriter();
+
+	/**
+	 * @brief Write chunks of property revision data remote engine does not have yet (see FProperty::ReplicateChunks()).
+	 * @param stream - output stream.
+	 * @param property - chunked property (see FProperty::IsChunked()).
+	 * @return true if chunks were written, false - remote engine has all chunks.
+	 */
+	virtual bool WriteChunks(FOStream& stream, const FProperty& property) = 0;
+
 };
 
 /**
@@ -193,9 +315,83 @@ private:
 };
 
 /**
- * @brief FPropertyTemplate class.
+ * @brief FPropertyMutator class. Scoped mutable access to property target, property is marked dirty on scope exit.
+ * Large property values (e.g. vectors, strings) may be modified in place without copying.
+ * @param T - property type.
  */
 template <class T>
+class FPropertyMutator
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 * @param property - property to mark dirty.
+	 * @param target - target property object reference.
+	 */
+	FPropertyMutator(FProperty& property, T& target)
+		: _property(&property)
+		, _target(target)
+	{
+	}
+
+	/**
+	 * @brief Move constructor, only the last owner marks property dirty.
+	 * @param other - mutator to move from.
+	 */
+	FPropertyMutator(FPropertyMutator&& other)
+		: _property(other._property)
+		, _target(other._target)
+	{
+		other._property = nullptr;
+	}
+
+	FPropertyMutator(const FPropertyMutator&) = delete;
+	FPropertyMutator& operator=(const FPropertyMutator&) = delete;
+
+	/**
+	 * @brief Destructor, marks property dirty.
+	 */
+	~FPropertyMutator()
+	{
+		if (_property)
+		{
+			_property->MarkDirty();
+		}
+	}
+
+	/**
+	 * @brief Get mutable property value.
+	 * @return property value reference.
+	 */
+	T& operator*() const
+	{
+		return _target;
+	}
+
+	/**
+	 * @brief Access mutable property value members.
+	 * @return property value pointer.
+	 */
+	T* operator->() const
+	{
+		return &_target;
+	}
+
+private:
+
+	FProperty* _property;
+	T& _target;
+
+};
+
+/**
+ * @brief FPropertyTemplate class.
+ * @param T - property type.
+ * @param TPacker - property packer (see NetworkPropertyPacker.h).
+ */
+template <class T, class TPacker = FPropertyPacker<T>>
 class FPropertyTemplate : public FProperty
 {
 
@@ -220,12 +416,50 @@ public:
 	{
 	}
 
+	/**
+	 * @brief Set property value and mark property dirty.
+	 * @param value - new property value.
+	 */
+	void Set(const T& value)
+	{
+		_target = value;
+		MarkDirty();
+	}
+
+	/**
+	 * @brief Set property value without copying and mark property dirty.
+	 * @param value - new property value to move from.
+	 */
+	void Set(T&& value)
+	{
+		_target = std::move(value);
+		MarkDirty();
+	}
+
+	/**
+	 * @brief Get scoped mutable access to property value, property is marked dirty on scope exit.
+	 * @return property mutator.
+	 */
+	FPropertyMutator<T> Mutate()
+	{
+		return FPropertyMutator<T>(*this, _target);
+	}
+
+	/**
+	 * @brief See FProperty::GetEncoding().
+	 */
+	virtual EPropertyEncoding GetEncoding() const override
+	{
+		return TPacker::Encoding();
+	}
+
 	/**
 	 * @brief See FProperty::operator<<().
 	 */
 	virtual void operator<<(FIStream& stream) override
 	{
-		stream >> _target;
+		TPacker::Unpack(stream, _target);
+		MarkDirty();
 	}
 
 	/**
@@ -233,7 +467,7 @@ public:
 	 */
 	virtual void operator>>(FOStream& stream) const override
 	{
-		stream << _target;
+		TPacker::Pack(stream, _target);
 	}
 
 private:
@@ -244,9 +478,11 @@ private:
 
 /**
  * @brief FPropertyTemplate class.
+ * @param T - property vector element type.
+ * @param TPacker - property packer (see NetworkPropertyPacker.h).
  */
-template <class T>
-class FPropertyTemplate <std::vector<T>> : public FVectorProperty
+template <class T, class TPacker>
+class FPropertyTemplate <std::vector<T>, TPacker> : public FVectorProperty
 {
 
 public:
@@ -270,12 +506,50 @@ public:
 	{
 	}
 
+	/**
+	 * @brief Set property value and mark property dirty.
+	 * @param value - new property value.
+	 */
+	void Set(const std::vector<T>& value)
+	{
+		_target = value;
+		MarkDirty();
+	}
+
+	/**
+	 * @brief Set property value without copying and mark property dirty.
+	 * @param value - new property value to move from.
+	 */
+	void Set(std::vector<T>&& value)
+	{
+		_target = std::move(value);
+		MarkDirty();
+	}
+
+	/**
+	 * @brief Get scoped mutable access to property value, property is marked dirty on scope exit.
+	 * @return property mutator.
+	 */
+	FPropertyMutator<std::vector<T>> Mutate()
+	{
+		return FPropertyMutator<std::vector<T>>(*this, _target);
+	}
+
+	/**
+	 * @brief See FProperty::GetEncoding().
+	 */
+	virtual EPropertyEncoding GetEncoding() const override
+	{
+		return TPacker::Encoding();
+	}
+
 	/**
 	 * @brief See FProperty::operator<<().
 	 */
 	virtual void operator<<(FIStream& stream) override
 	{
-		stream >> _target;
+		TPacker::Unpack(stream, _target);
+		MarkDirty();
 	}
 
 	/**
@@ -283,7 +557,7 @@ public:
 	 */
 	virtual void operator>>(FOStream& stream) const override
 	{
-		stream << _target;
+		TPacker::Pack(stream, _target);
 	}
 
 private:
@@ -293,7 +567,7 @@ private:
 };
 
 /**
- * @brief Network function macro.
+ * @brief Network function macro. Property value should be changed through Property<Name>.Set() or Property<Name>.Mutate() to be marked dirty.
  * @param T - network property type.
  * @param Name - network property name.
  */
@@ -301,5 +575,15 @@ private:
 	T Name = T(__VA_ARGS__); \
 	FPropertyTemplate<T> Property ## Name ## = FPropertyTemplate<T>(this, #Name, this-> ## Name ## );
 
+/**
+ * @brief Network function macro with custom packer. Packer type with template arguments should be declared by typedef.
+ * @param T - network property type.
+ * @param Name - network property name.
+ * @param TPacker - network property packer.
+ */
+#define GX_NETWORK_PROPERTY_PACKED(T, Name, TPacker, ...) \
+	T Name = T(__VA_ARGS__); \
+	FPropertyTemplate<T, TPacker> Property ## Name ## = FPropertyTemplate<T, TPacker>(this, #Name, this-> ## Name ## );
+
 }
 }
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "../../Include/Common/NetworkBitStream.h"
+#include "../../Include/Common/NetworkTypes.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief EPropertyEncoding enum. Property packer encoding, sent with class schema so both sides agree on property layout.
+ */
+enum class EPropertyEncoding : uint8_t
+{
+	Raw			= 0,	//<! FPropertyPacker
+	Bits		= 1,	//<! FBitsPacker
+	VarBits		= 2,	//<! FVarBitsPacker
+	FixedVec3f	= 3,	//<! FFixedVec3fPacker
+	OctVec3f	= 4,	//<! FOctVec3fPacker
+	VarInt		= 5,	//<! FVarIntPacker
+	Custom		= 0x80,	//<! first encoding of properties serialized by their own classes outside of the library
+};
+
+/**
+ * @brief FPropertyPacker struct. Default property packer, value is written byte aligned at full size.
+ */
+template <class T>
+struct FPropertyPacker
+{
+	static EPropertyEncoding Encoding() { return EPropertyEncoding::Raw; }
+
+	static void Pack(FOStream& stream, const T& value)
+	{
+		stream << value;
+	}
+
+	static void Unpack(FIStream& stream, T& value)
+	{
+		stream >> value;
+	}
+};
+
+/**
+ * @brief FBitsPacker struct. Unsigned integral, enum or bool value packed into BitsCount bits.
+ */
+template <class T, uint32_t BitsCount>
+struct FBitsPacker
+{
+	static_assert(BitsCount > 0 && BitsCount <= 32, "Bits count should be in range 1..32.");
+	static_assert(std::is_enum<T>::value || std::is_unsigned<T>::value, "Only unsigned integral, enum and bool types are accepted.");
+
+	static EPropertyEncoding Encoding() { return EPropertyEncoding::Bits; }
+
+	static void Pack(FOStream& stream, const T& value)
+	{
+		FBitOStream bits(stream);
+		bits.WriteBits(static_cast<uint32_t>(value), BitsCount);
+	}
+
+	static void Unpack(FIStream& stream, T& value)
+	{
+		FBitIStream bits(stream);
+		value = static_cast<T>(bits.ReadBits(BitsCount));
+	}
+};
+
+/**
+ * @brief FVarBitsPacker struct. Unsigned integral value (counters, sizes) packed as groups of GroupBits bits.
+ */
+template <class T, uint32_t GroupBits = 3>
+struct FVarBitsPacker
+{
+	static_assert(std::is_unsigned<T>::value && sizeof(T) <= sizeof(uint32_t), "Only unsigned integral types up to 32 bits are accepted.");
+
+	static EPropertyEncoding Encoding() { return EPropertyEncoding::VarBits; }
+
+	static void Pack(FOStream& stream, const T& value)
+	{
+		FBitOStream bits(stream);
+		bits.WriteVarUInt(static_cast<uint32_t>(value), GroupBits);
+	}
+
+	static void Unpack(FIStream& stream, T& value)
+	{
+		FBitIStream bits(stream);
+		value = static_cast<T>(bits.ReadVarUInt(GroupBits));
+	}
+};
+
+/**
+ * @brief FVarIntPacker struct. Integral value up to 32 bits written byte aligned as variable length integer (1..5 bytes).
+ * Signed values are ZigZag mapped first, so small negative values stay short as well.
+ */
+template <class T>
+struct FVarIntPacker
+{
+	static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(uint32_t), "Only integral types up to 32 bits are accepted.");
+
+	static EPropertyEncoding Encoding() { return EPropertyEncoding::VarInt; }
+
+	static void Pack(FOStream& stream, const T& value)
+	{
+		stream.WriteVarUInt(ZigZagEncode(value, std::is_signed<T>()));
+	}
+
+	static void Unpack(FIStream& stream, T& value)
+	{
+		value = ZigZagDecode(stream.ReadVarUInt(), std::is_signed<T>());
+	}
+
+private:
+
+	static uint32_t ZigZagEncode(T value, std::true_type)
+	{
+		int32_t signedValue = static_cast<int32_t>(value);
+		return (static_cast<uint32_t>(signedValue) << 1) ^ static_cast<uint32_t>(signedValue >> 31);
+	}
+
+	static uint32_t ZigZagEncode(T value, std::false_type)
+	{
+		return static_cast<uint32_t>(value);
+	}
+
+	static T ZigZagDecode(uint32_t value, std::true_type)
+	{
+		return static_cast<T>(static_cast<int32_t>((value >> 1) ^ (0u - (value & 1))));
+	}
+
+	static T ZigZagDecode(uint32_t value, std::false_type)
+	{
+		return static_cast<T>(value);
+	}
+};
+
+/**
+ * @brief FQuantization struct. Uniform scalar quantization helpers.
+ */
+struct FQuantization
+{
+	/**
+	 * @brief Quantize value clamped to [minValue, maxValue] range into bitsCount bits.
+	 */
+	static uint32_t Quantize(float value, float minValue, float maxValue, uint32_t bitsCount)
+	{
+		uint32_t steps = bitsCount == 32 ? 0xFFFFFFFF : (1u << bitsCount) - 1;
+		float normalized = (value - minValue) / (maxValue - minValue);
+		normalized = normalized < 0.0f ? 0.0f : (normalized > 1.0f ? 1.0f : normalized);
+		return static_cast<uint32_t>(normalized * static_cast<float>(steps) + 0.5f);
+	}
+
+	/**
+	 * @brief Restore value quantized by Quantize().
+	 */
+	static float Dequantize(uint32_t value, float minValue, float maxValue, uint32_t bitsCount)
+	{
+		uint32_t steps = bitsCount == 32 ? 0xFFFFFFFF : (1u << bitsCount) - 1;
+		return minValue + (maxValue - minValue) * (static_cast<float>(value) / static_cast<float>(steps));
+	}
+};
+
+/**
+ * @brief FFixedVec3fPacker struct. FVec3f packed as fixed-point components in [MinValue, MaxValue] range, BitsCount bits each.
+ * Precision is (MaxValue - MinValue) / (2^BitsCount - 1), values out of range are clamped.
+ */
+template <int32_t MinValue, int32_t MaxValue, uint32_t BitsCount>
+struct FFixedVec3fPacker
+{
+	static_assert(MinValue < MaxValue, "Invalid range.");
+	static_assert(BitsCount > 0 && BitsCount <= 24, "Bits count should be in range 1..24.");
+
+	static EPropertyEncoding Encoding() { return EPropertyEncoding::FixedVec3f; }
+
+	static void Pack(FOStream& stream, const FVec3f& value)
+	{
+		FBitOStream bits(stream);
+		bits.WriteBits(FQuantization::Quantize(value.x, MinValue, MaxValue, BitsCount), BitsCount);
+		bits.WriteBits(FQuantization::Quantize(value.y, MinValue, MaxValue, BitsCount), BitsCount);
+		bits.WriteBits(FQuantization::Quantize(value.z, MinValue, MaxValue, BitsCount), BitsCount);
+	}
+
+	static void Unpack(FIStream& stream, FVec3f& value)
+	{
+		FBitIStream bits(stream);
+		value.x = FQuantization::Dequantize(bits.ReadBits(BitsCount), MinValue, MaxValue, BitsCount);
+		value.y = FQuantization::Dequantize(bits.ReadBits(BitsCount), MinValue, MaxValue, BitsCount);
+		value.z = FQuantization::Dequantize(bits.ReadBits(BitsCount), MinValue, MaxValue, BitsCount);
+	}
+};
+
+/**
+ * @brief FOctVec3fPacker struct. Direction FVec3f packed with octahedral encoding, BitsCount bits per each of two components.
+ * Leading bit marks zero vector, any other vector is restored normalized.
+ */
+template <uint32_t BitsCount>
+struct FOctVec3fPacker
+{
+	static_assert(BitsCount > 1 && BitsCount <= 16, "Bits count should be in range 2..16.");
+
+	static EPropertyEncoding Encoding() { return EPropertyEncoding::OctVec3f; }
+
+	static void Pack(FOStream& stream, const FVec3f& value)
+	{
+		FBitOStream bits(stream);
+		float length = std::fabs(value.x) + std::fabs(value.y) + std::fabs(value.z);
+		bits.WriteBool(length > 0.0f);
+		if (length > 0.0f)
+		{
+			float u = value.x / length;
+			float v = value.y / length;
+			if (value.z < 0.0f)
+			{
+				float t = (1.0f - std::fabs(v)) * Sign(u);
+				v = (1.0f - std::fabs(u)) * Sign(v);
+				u = t;
+			}
+			bits.WriteBits(FQuantization::Quantize(u, -1.0f, 1.0f, BitsCount), BitsCount);
+			bits.WriteBits(FQuantization::Quantize(v, -1.0f, 1.0f, BitsCount), BitsCount);
+		}
+	}
+
+	static void Unpack(FIStream& stream, FVec3f& value)
+	{
+		FBitIStream bits(stream);
+		if (!bits.ReadBool())
+		{
+			value = FVec3f(0.0f, 0.0f, 0.0f);
+			return;
+		}
+		float x = FQuantization::Dequantize(bits.ReadBits(BitsCount), -1.0f, 1.0f, BitsCount);
+		float y = FQuantization::Dequantize(bits.ReadBits(BitsCount), -1.0f, 1.0f, BitsCount);
+		float z = 1.0f - std::fabs(x) - std::fabs(y);
+		if (z < 0.0f)
+		{
+			float t = (1.0f - std::fabs(y)) * Sign(x);
+			y = (1.0f - std::fabs(x)) * Sign(y);
+			x = t;
+		}
+		float length = std::sqrt(x * x + y * y + z * z);
+		value = FVec3f(x / length, y / length, z / length);
+	}
+
+private:
+
+	static float Sign(float value)
+	{
+		return value < 0.0f ? -1.0f : 1.0f;
+	}
+};
+
+}
+}
\ No newline at end of file
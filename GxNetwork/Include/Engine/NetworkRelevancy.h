@@ -0,0 +1,73 @@
+#pragma once
+
+#include "NetworkObject.h"
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FRemoteEngine class forward decl.
+ */
+class FRemoteEngine;
+
+/**
+ * @brief FRemoteEngine class shared pointer forward decl.
+ */
+typedef std::shared_ptr<FRemoteEngine> FRemoteEnginePtr;
+
+/**
+ * @brief FRelevancyPolicy class. Decides which objects go into replication frame of each remote engine and how urgent they are (delta replication mode).
+ * Objects reporting FObject::IsAlwaysRelevant() are not checked.
+ */
+class GX_NETWORK_EXPORT FRelevancyPolicy
+{
+
+public:
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FRelevancyPolicy();
+
+	/**
+	 * @brief Called before objects of remote engine replication frame are checked.
+	 * @param engine - local engine.
+	 * @param remoteEngine - remote engine the frame is built for.
+	 */
+	virtual void BeginFrame(const FEngine& engine, const FRemoteEnginePtr& remoteEngine);
+
+	/**
+	 * @brief Check if object should be replicated to remote engine.
+	 * @param object - replicated object.
+	 * @param remoteEngine - remote engine the frame is built for.
+	 * @return true if object is relevant, false - otherwise.
+	 */
+	virtual bool IsRelevant(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) = 0;
+
+	/**
+	 * @brief Gather objects of engine spatial grid which may be relevant for remote engine, called after BeginFrame().
+	 * Objects missing in the grid and always relevant objects are checked by the engine separately.
+	 * @param engine - local engine.
+	 * @param remoteEngine - remote engine the frame is built for.
+	 * @param handles - [out] candidate object handles.
+	 * @return true if candidates were gathered, false - every object of the engine is checked (default).
+	 */
+	virtual bool GatherCandidates(const FEngine& engine, const FRemoteEnginePtr& remoteEngine, std::vector<FObjectHandle>& handles);
+
+	/**
+	 * @brief Get object replication priority scale for remote engine (e.g. by distance), called for relevant objects only.
+	 * @param object - replicated object.
+	 * @param remoteEngine - remote engine the frame is built for.
+	 * @return priority scale (1 - default).
+	 */
+	virtual float GetPriorityScale(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine);
+
+};
+
+/**
+ * @brief FRelevancyPolicy class shared pointer decl.
+ */
+typedef std::shared_ptr<FRelevancyPolicy> FRelevancyPolicyPtr;
+
+}
+}
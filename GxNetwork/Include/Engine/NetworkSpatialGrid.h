@@ -0,0 +1,113 @@
+#pragma once
+
+#include "../Common/NetworkTypes.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FSpatialGrid class. Uniform spatial hash of object locations, keyed by object handles.
+ * Only occupied cells are stored, queries visit cells overlapping the query volume, so they cost O(k) in nearby objects.
+ */
+class GX_NETWORK_EXPORT FSpatialGrid
+{
+
+public:
+
+	enum : uint32_t
+	{
+		DefaultCellSize = 64,
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param cellSize - cell edge length.
+	 */
+	FSpatialGrid(float cellSize = DefaultCellSize);
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FSpatialGrid();
+
+	/**
+	 * @brief Insert object or update its location.
+	 * @param handle - object handle.
+	 * @param location - object location.
+	 */
+	void Update(const FObjectHandle& handle, const FVec3f& location);
+
+	/**
+	 * @brief Remove object.
+	 * @param handle - object handle.
+	 */
+	void Remove(const FObjectHandle& handle);
+
+	/**
+	 * @brief Remove all objects.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Check if object is stored in grid.
+	 * @param handle - object handle.
+	 * @return true if object is stored, false - otherwise.
+	 */
+	bool Contains(const FObjectHandle& handle) const;
+
+	/**
+	 * @brief Find objects within the sphere.
+	 * @param center - sphere center.
+	 * @param radius - sphere radius.
+	 * @param handles - [out] found object handles (appended).
+	 */
+	void QueryRadius(const FVec3f& center, float radius, std::vector<FObjectHandle>& handles) const;
+
+	/**
+	 * @brief Find objects within the axis aligned box.
+	 * @param min - box min corner.
+	 * @param max - box max corner.
+	 * @param handles - [out] found object handles (appended).
+	 */
+	void QueryBox(const FVec3f& min, const FVec3f& max, std::vector<FObjectHandle>& handles) const;
+
+	/**
+	 * @brief Get cell edge length.
+	 * @return cell edge length.
+	 */
+	float GetCellSize() const;
+
+private:
+
+	struct FEntry
+	{
+		FObjectHandle Handle;
+		FVec3f Location;
+		uint64_t CellKey;
+		uint32_t CellPosition;
+	};
+
+	uint64_t GetCellKey(const FVec3f& location) const;
+	int32_t GetCellCoord(float value) const;
+	static uint64_t MakeCellKey(int32_t x, int32_t y, int32_t z);
+
+	void RemoveFromCell(const FEntry& entry);
+
+	template <class FPredicate>
+	void Query(const FVec3f& min, const FVec3f& max, const FPredicate& predicate, std::vector<FObjectHandle>& handles) const;
+
+	float _cellSize;
+	float _inverseCellSize;
+
+	// Entries by handle index.
+	std::vector<FEntry> _entries;
+	// Handle indices of objects by cell key.
+	std::unordered_map<uint64_t, std::vector<uint32_t>> _cells;
+
+};
+
+}
+}
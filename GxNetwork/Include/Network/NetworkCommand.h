@@ -1,6 +1,7 @@
 #pragma once
 
 #include "NetworkAPI.h"
+#include "../Common/NetworkCodec.h"
 #include "../Common/NetworkTypes.h"
 
 namespace gx { 
@@ -61,6 +62,43 @@ FOStream& operator<<(FOStream& stream, const FCommand<Command>& command)
 	return stream;
 }
 
+/**
+ * @brief FFrameCommand struct. Common part of frame commands, frame data may be compressed (see FManager::CompressFrame()).
+ */
+struct GX_NETWORK_EXPORT FFrameCommand
+{
+	ECodec Codec = ECodec::None;
+	uint32_t UncompressedSize = 0;
+	uint32_t FrameSize = 0;
+	const uint8_t* FrameData = nullptr;
+	// Compressed or decompressed frame, FrameData points into it when frame is transcoded.
+	FBuffer FrameStorage;
+
+protected:
+
+	void Deserialize(FIStream& stream)
+	{
+		stream >> Codec;
+		if (Codec != ECodec::None)
+		{
+			UncompressedSize = stream.ReadVarUInt();
+		}
+		FrameSize = stream.ReadVarUInt();
+		FrameData = stream.Read(FrameSize);
+	}
+
+	void Serialize(FOStream& stream) const
+	{
+		stream << Codec;
+		if (Codec != ECodec::None)
+		{
+			stream.WriteVarUInt(UncompressedSize);
+		}
+		stream.WriteVarUInt(FrameSize);
+		stream.Write(FrameData, FrameSize);
+	}
+};
+
 /**
  * @brief FCommand<Ping> struct.
  */
@@ -113,12 +151,15 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::Pong>
 template <>
 struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRequest>
 {
+	// Codecs the requester is able to decode frames with (see FManager::GetAcceptedCodecs()).
+	uint32_t AcceptedCodecs = 0;
+
 	/**
 	 * @brief See FCommand::operator<<(FIStream&).
 	 */
-	void operator<<(FIStream&)
+	void operator<<(FIStream& stream)
 	{
-
+		AcceptedCodecs = stream.ReadVarUInt();
 	}
 	
 	/**
@@ -126,7 +167,7 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRequest>
 	 */
 	void operator>>(FOStream& stream) const
 	{
-
+		stream.WriteVarUInt(AcceptedCodecs);
 	}
 };
 
@@ -134,18 +175,14 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRequest>
  * @brief FCommand<EventsFrameRecieve> struct.
  */
 template <>
-struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRecieve>
+struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRecieve> : public FFrameCommand
 {
-	uint32_t FrameSize = 0;
-	const uint8_t* FrameData = nullptr;
-	
 	/**
 	 * @brief See FCommand::operator<<(FIStream&).
 	 */
 	void operator<<(FIStream& stream)
 	{
-		stream >> FrameSize;
-		FrameData = stream.Read(FrameSize);
+		Deserialize(stream);
 	}
 	
 	/**
@@ -153,8 +190,7 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRecieve>
 	 */
 	void operator>>(FOStream& stream) const
 	{
-		stream << FrameSize;
-		stream.Write(FrameData, FrameSize);
+		Serialize(stream);
 	}
 };
 
@@ -164,12 +200,17 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::EventsFrameRecieve>
 template <>
 struct GX_NETWORK_EXPORT FCommand <ECommand::ReplicationFrameRequest>
 {
+	uint32_t AcknowledgedFrameIndex = 0;
+	// Codecs the requester is able to decode frames with (see FManager::GetAcceptedCodecs()).
+	uint32_t AcceptedCodecs = 0;
+
 	/**
 	 * @brief See FCommand::operator<<(FIStream&).
 	 */
-	void operator<<(FIStream&)
+	void operator<<(FIStream& stream)
 	{
-
+		stream >> AcknowledgedFrameIndex;
+		AcceptedCodecs = stream.ReadVarUInt();
 	}
 	
 	/**
@@ -177,7 +218,8 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::ReplicationFrameRequest>
 	 */
 	void operator>>(FOStream& stream) const
 	{
-
+		stream << AcknowledgedFrameIndex;
+		stream.WriteVarUInt(AcceptedCodecs);
 	}
 };
 
@@ -185,18 +227,14 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::ReplicationFrameRequest>
  * @brief FCommand<ReplicationFrameRecieve> struct.
  */
 template <>
-struct GX_NETWORK_EXPORT FCommand <ECommand::ReplicationFrameRecieve>
+struct GX_NETWORK_EXPORT FCommand <ECommand::ReplicationFrameRecieve> : public FFrameCommand
 {
-	uint32_t FrameSize = 0;
-	const uint8_t* FrameData = nullptr;
-	
 	/**
 	 * @brief See FCommand::operator<<(FIStream&).
 	 */
 	void operator<<(FIStream& stream)
 	{
-		stream >> FrameSize;
-		FrameData = stream.Read(FrameSize);
+		Deserialize(stream);
 	}
 	
 	/**
@@ -204,10 +242,9 @@ struct GX_NETWORK_EXPORT FCommand <ECommand::ReplicationFrameRecieve>
 	 */
 	void operator>>(FOStream& stream) const
 	{
-		stream << FrameSize;
-		stream.Write(FrameData, FrameSize);
+		Serialize(stream);
 	}
 };
 
 }
-}
\ No newline at end of file
+}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../Common/NetworkTypes.h"
+#include "../Common/NetworkSchema.h"
 
 namespace gx { 
 namespace network {
@@ -13,6 +13,7 @@ enum class GX_NETWORK_EXPORT EEvent : uint8_t
 	CreateObject = 0,
 	RemoveObject,
 	ExecFunctionRemote,
+	ClassSchema,
 	MaxValue,
 };
 
@@ -79,7 +80,7 @@ struct GX_NETWORK_EXPORT FEvent <EEvent::CreateObject>
 {
 	FGuid GUID;
 	FGuid OwnerGUID;
-	std::string ClassName;
+	uint16_t ClassID = 0;
 
 	/**
 	 * @brief See FEvent::operator<<(FIStream&).
@@ -87,7 +88,7 @@ struct GX_NETWORK_EXPORT FEvent <EEvent::CreateObject>
 	void operator<<(FIStream& stream)
 	{
 		stream >> GUID;
-		stream >> ClassName;
+		stream >> ClassID;
 		stream >> OwnerGUID;
 	}
 	
@@ -97,7 +98,7 @@ struct GX_NETWORK_EXPORT FEvent <EEvent::CreateObject>
 	void operator>>(FOStream& stream) const
 	{
 		stream << GUID;
-		stream << ClassName;
+		stream << ClassID;
 		stream << OwnerGUID;
 	}
 };
@@ -128,13 +129,13 @@ struct GX_NETWORK_EXPORT FEvent <EEvent::RemoveObject>
 };
 
 /**
- * @brief FEvent<ExecFunctionRemote> struct.
+ * @brief FEvent<ExecFunctionRemote> struct. Decoded function name and parameters point into the events frame.
  */
 template <>
 struct GX_NETWORK_EXPORT FEvent <EEvent::ExecFunctionRemote>
 {
 	FGuid GUID;
-	std::string FunctionName;
+	FStringView FunctionName;
 	uint32_t ParametersSize = 0;
 	const uint8_t* ParametersData = nullptr;
 
@@ -145,7 +146,7 @@ struct GX_NETWORK_EXPORT FEvent <EEvent::ExecFunctionRemote>
 	{
 		stream >> GUID;
 		stream >> FunctionName;
-		stream >> ParametersSize;
+		ParametersSize = stream.ReadVarUInt();
 		ParametersData = stream.Read(ParametersSize);
 	}
 	
@@ -156,10 +157,45 @@ struct GX_NETWORK_EXPORT FEvent <EEvent::ExecFunctionRemote>
 	{
 		stream << GUID;
 		stream << FunctionName;
-		stream << ParametersSize;
+		stream.WriteVarUInt(ParametersSize);
 		stream.Write(ParametersData, ParametersSize);
 	}
 };
 
+/**
+ * @brief FEvent<ClassSchema> struct.
+ */
+template <>
+struct GX_NETWORK_EXPORT FEvent <EEvent::ClassSchema>
+{
+	std::vector<FClassSchema> Classes;
+
+	/**
+	 * @brief See FEvent::operator<<(FIStream&).
+	 */
+	void operator<<(FIStream& stream)
+	{
+		uint32_t classesCount = 0;
+		stream >> classesCount;
+		Classes.resize(classesCount);
+		for (FClassSchema& classSchema : Classes)
+		{
+			stream >> classSchema;
+		}
+	}
+	
+	/**
+	 * @brief See FEvent::operator>>(FOStream&).
+	 */
+	void operator>>(FOStream& stream) const
+	{
+		stream << GX_NETWORK_SIZE_T_TO_UINT_32_T(Classes.size());
+		for (const FClassSchema& classSchema : Classes)
+		{
+			stream << classSchema;
+		}
+	}
+};
+
 }
 }
\ No newline at end of file
@@ -17,6 +17,16 @@ class GX_NETWORK_EXPORT FManager
 
 public:
 
+	enum : uint32_t
+	{
+		DefaultCompressionThreshold = 512,
+	};
+
+	/**
+	 * @brief Constructor.
+	 */
+	FManager();
+
 	/**
 	 * @brief Destructor.
 	 */
@@ -33,16 +43,19 @@ public:
 	void Shutdown();
 
 	/**
-	 * @brief Broadcast event for clients.
+	 * @brief Broadcast event for clients. Event is serialized once and shared by all remote engines.
+	 * Remote engines snapshot is used, no lock is held.
 	 * @param event - event object.
 	 */
 	template <EEvent Event>
 	void BroadcastEvent(const FEvent<Event>& event)
 	{
-		std::vector<FRemoteEnginePtr>& remoteEngines = LockRemoteEngines();
-		for (FRemoteEnginePtr& remoteEngine : remoteEngines)
-			remoteEngine->PushEvent(event);
-		UnLockRemoteEngines();
+		FRemoteEnginesSnapshot remoteEngines = GetRemoteEnginesSnapshot();
+		if (remoteEngines->empty())
+			return;
+		FConstBufferPtr eventData = FRemoteEngine::SerializeEvent(event);
+		for (const FRemoteEnginePtr& remoteEngine : *remoteEngines)
+			remoteEngine->PushEventData(eventData);
 	}
 
 	/**
@@ -66,8 +79,51 @@ public:
 	 */
 	void RemoteEngineDisconnected(const FGuid& remoteEngineGUID);
 
+	/**
+	 * @brief Set local class schema, sent as the first event to every remote engine.
+	 * @param classes - local classes schema.
+	 */
+	void SetClassSchema(const std::vector<FClassSchema>& classes);
+
+	/**
+	 * @brief Get connected remote engines.
+	 * @return remote engines array copy.
+	 */
+	std::vector<FRemoteEnginePtr> GetRemoteEngines();
+
+	/**
+	 * @brief Register frame codec, the latest registered codec is preferred for outgoing frames.
+	 * Codec of the same type is replaced. Should be called before Init() or from OnInit(). FLZCodec is registered by default.
+	 * @param codec - codec object.
+	 */
+	void RegisterCodec(const FCodecPtr& codec);
+
+	/**
+	 * @brief Register dictionary codec (ECodec::LZDictionary) preferred for outgoing frames, may be called from OnInit().
+	 * Remote engines should load the same dictionary (see FLZCodec::TrainDictionary()).
+	 * @param dictionary - dictionary data.
+	 */
+	void SetCompressionDictionary(const FBufferView& dictionary);
+
+	/**
+	 * @brief Get codecs local engine is able to decode frames with, should be sent with frame requests.
+	 * @return codecs mask (bit per ECodec value).
+	 */
+	uint32_t GetAcceptedCodecs() const;
+
+	/**
+	 * @brief Set minimal frame size to compress, smaller frames are sent as is.
+	 * @param threshold - frame size in bytes.
+	 */
+	void SetCompressionThreshold(uint32_t threshold);
+
 private:
 
+	typedef std::shared_ptr<const std::vector<FRemoteEnginePtr>> FRemoteEnginesSnapshot;
+
+	FRemoteEnginesSnapshot GetRemoteEnginesSnapshot() const;
+	void UpdateRemoteEnginesSnapshot();
+
 	FRemoteEnginePtr CreateRemoteEngine(const FGuid& remoteEngineGUID);
 	FRemoteEnginePtr RemoveRemoteEngine(const FGuid& remoteEngineGUID);
 
@@ -80,6 +136,9 @@ private:
 	bool ProcessResponseReplicationFrameRequest(const FRemoteEnginePtr& remoteEngine, const FCommand<ECommand::ReplicationFrameRequest>& inCommand, FOStream& stream);
 	bool ProcessResponseReplicationFrameRecieve(const FRemoteEnginePtr& remoteEngine, const FCommand<ECommand::ReplicationFrameRecieve>& inCommand, FOStream& stream);
 
+	bool DecompressFrame(const FRemoteEnginePtr& remoteEngine, FFrameCommand& command) const;
+	const FCodecPtr* FindCodec(ECodec codec) const;
+
 protected:
 
 	/**
@@ -123,7 +182,7 @@ protected:
 	virtual bool OnProcessResponsePong(const FRemoteEnginePtr& remoteEngine, const FCommand<ECommand::Pong>& inCommand, FOStream& stream) = 0;
 
 	/**
-	 * @brief Process 'EventsFrameRequest' command response.
+	 * @brief Process 'EventsFrameRequest' command response. Frame should be written with WriteEventsFrame().
 	 * @param remoteEngine - remote engine object.
 	 * @param inCommand - command data.
 	 * @param stream - output stream.
@@ -141,7 +200,7 @@ protected:
 	virtual bool OnProcessResponseEventsFrameRecieve(const FRemoteEnginePtr& remoteEngine, const FCommand<ECommand::EventsFrameRecieve>& inCommand, FOStream& stream) = 0;
 
 	/**
-	 * @brief Process 'ReplicationFrameRequest' command response.
+	 * @brief Process 'ReplicationFrameRequest' command response. Frame should be written with WriteReplicationFrame().
 	 * @param remoteEngine - remote engine object.
 	 * @param inCommand - command data.
 	 * @param stream - output stream.
@@ -162,6 +221,14 @@ private:
 
 	mutable std::mutex _remoteEnginesLock;
 	std::vector<FRemoteEnginePtr> _remoteEngines;
+	// Immutable copy of _remoteEngines, replaced on connect / disconnect.
+	FRemoteEnginesSnapshot _remoteEnginesSnapshot;
+
+	FConstBufferPtr _classSchemaEventData;
+
+	// Registered codecs, the most preferred first.
+	std::vector<FCodecPtr> _codecs;
+	uint32_t _compressionThreshold;
 
 protected:
 
@@ -176,6 +243,32 @@ protected:
 	 */
 	std::vector<FRemoteEnginePtr>& LockRemoteEngines();
 
+	/**
+	 * @brief Compress frame of outgoing command with the preferred codec accepted by remote engine.
+	 * Frame is left as is if it is smaller than compression threshold or does not shrink.
+	 * Called by WriteEventsFrame() and WriteReplicationFrame(), frame commands written otherwise should be passed through it.
+	 * @param remoteEngine - remote engine object.
+	 * @param command - frame command with FrameData and FrameSize set.
+	 */
+	void CompressFrame(const FRemoteEnginePtr& remoteEngine, FFrameCommand& command) const;
+
+	/**
+	 * @brief Write 'EventsFrameRecieve' command with remote engine events frame compressed for remote engine (see CompressFrame()).
+	 * Should be used to respond from OnProcessResponseEventsFrameRequest(), after accepted codecs of remote engine are updated.
+	 * @param remoteEngine - remote engine object.
+	 * @param stream - output stream.
+	 */
+	void WriteEventsFrame(const FRemoteEnginePtr& remoteEngine, FOStream& stream) const;
+
+	/**
+	 * @brief Write 'ReplicationFrameRecieve' command with replication frame compressed for remote engine (see CompressFrame()).
+	 * Should be used to respond from OnProcessResponseReplicationFrameRequest(), after accepted codecs of remote engine are updated.
+	 * @param remoteEngine - remote engine object.
+	 * @param frame - replication frame (FEngine::GetReplicationFrame() in full replication mode, FRemoteEngine::GetReplicationFrame() in delta one).
+	 * @param stream - output stream.
+	 */
+	void WriteReplicationFrame(const FRemoteEnginePtr& remoteEngine, const FBuffer& frame, FOStream& stream) const;
+
 	/**
 	 * @brief Find connected remote engine.
 	 * @param remoteEngineGUID - remote engine GUID.
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "NetworkEvent.h"
+#include "../Common/NetworkQueue.h"
+
+#include <atomic>
 
 namespace gx {
 namespace network {
@@ -13,6 +16,42 @@ class GX_NETWORK_EXPORT FRemoteEngine
 
 public:
 
+	/**
+	 * @brief FRemoteEngine::FPropertyTransfer struct. Chunked transfer state of local object property for remote engine.
+	 */
+	struct FPropertyTransfer
+	{
+		uint32_t PropertyIndex = 0;
+		// Frame chunk is sent with since (0 - chunk is not sent), chunk is sent with every frame till it is acknowledged.
+		std::vector<uint32_t> ChunkFrameIndices;
+		// Frame chunk data remote engine has is taken from (0 - no data).
+		std::vector<uint32_t> ChunkRevisions;
+	};
+
+	/**
+	 * @brief FRemoteEngine::FObjectReplication struct. Replication state of local object for remote engine (delta replication mode).
+	 */
+	struct FObjectReplication
+	{
+		FObjectHandle Handle;
+		// Frame object is relevant since (0 - object is not relevant).
+		uint32_t RelevancyFrameIndex = 0;
+		// Object relevancy was checked by the frame being built.
+		bool bChecked = false;
+		// Object changes were deferred by bandwidth budget, baseline is limited by the one of the first deferral.
+		bool bDeferred = false;
+		uint32_t DeferredBaselineFrameIndex = 0;
+		// Frame object was sent with after deferral, deferral is over when it is acknowledged.
+		uint32_t CoverFrameIndex = 0;
+		// Priority accumulated while object waits to be sent.
+		float Priority = 0.0f;
+		// Object has chunks not acknowledged yet, so it is sent even without changes.
+		bool bTransferPending = false;
+		// Object has chunks sent with frames not acknowledged yet.
+		bool bTransferInFlight = false;
+		std::vector<FPropertyTransfer> PropertyTransfers;
+	};
+
 	/**
 	 * @brief Constructor.
 	 * @param GUID - remote engine GUID.
@@ -31,29 +70,181 @@ public:
 	const FGuid& GetGUID() const;
 
 	/**
-	 * @brief Get remote engine events frame.
+	 * @brief Get remote engine events frame. Pending events are moved to the frame first.
+	 * Should be called from the single consumer (network) thread.
 	 * @return events frame reference.
 	 */
 	FBuffer& GetEventsFrame();
 
 	/**
-	 * @brief Push event for remote engine.
+	 * @brief Get remote engine replication frame (delta replication mode).
+	 * @return replication frame reference.
+	 */
+	FBuffer& GetReplicationFrame();
+
+	/**
+	 * @brief Get index of the last local replication frame acknowledged by remote engine.
+	 * @return replication frame index (0 - nothing acknowledged yet).
+	 */
+	uint32_t GetAcknowledgedReplicationFrameIndex() const;
+
+	/**
+	 * @brief Set index of the last local replication frame acknowledged by remote engine.
+	 * @param frameIndex - replication frame index.
+	 */
+	void SetAcknowledgedReplicationFrameIndex(uint32_t frameIndex);
+
+	/**
+	 * @brief Get index of the last replication frame recieved from remote engine.
+	 * @return replication frame index (0 - nothing recieved yet).
+	 */
+	uint32_t GetRecievedReplicationFrameIndex() const;
+
+	/**
+	 * @brief Set index of the last replication frame recieved from remote engine.
+	 * @param frameIndex - replication frame index.
+	 */
+	void SetRecievedReplicationFrameIndex(uint32_t frameIndex);
+
+	/**
+	 * @brief Get codecs remote engine is able to decode frames with (negotiated with frame requests).
+	 * @return codecs mask (bit per ECodec value).
+	 */
+	uint32_t GetAcceptedCodecs() const;
+
+	/**
+	 * @brief Set codecs remote engine is able to decode frames with.
+	 * @param codecs - codecs mask (bit per ECodec value).
+	 */
+	void SetAcceptedCodecs(uint32_t codecs);
+
+	/**
+	 * @brief Set mappings of remote engine class schema to local classes.
+	 * @param classSchemaMappings - mappings by remote class ID.
+	 */
+	void SetClassSchemaMappings(std::vector<FClassSchemaMapping>&& classSchemaMappings);
+
+	/**
+	 * @brief Find mapping of remote engine class schema to local class.
+	 * @param classID - remote class ID.
+	 * @return class schema mapping on success, nullptr - otherwise.
+	 */
+	const FClassSchemaMapping* FindClassSchemaMapping(uint16_t classID) const;
+
+	/**
+	 * @brief Check if remote engine knows local object handle (frame with handle binding was acknowledged).
+	 * @param handle - local object handle.
+	 * @return true if handle may be sent without GUID, false - otherwise.
+	 */
+	bool IsObjectHandleBound(const FObjectHandle& handle) const;
+
+	/**
+	 * @brief Set replication frame which carries local object handle binding. The earliest frame is kept for the same handle,
+	 * so every frame since it should carry the binding till it is acknowledged (see ResetObjectHandleBindingFrame()).
+	 * @param handle - local object handle.
+	 * @param frameIndex - replication frame index.
+	 */
+	void SetObjectHandleBindingFrame(const FObjectHandle& handle, uint32_t frameIndex);
+
+	/**
+	 * @brief Reset binding frame of local object handle not acknowledged yet. Should be called when the frame
+	 * is built without the object, so the binding is counted since the next frame carrying it.
+	 * @param handle - local object handle.
+	 */
+	void ResetObjectHandleBindingFrame(const FObjectHandle& handle);
+
+	/**
+	 * @brief Get replication state of local object for remote engine. State is reset if handle slot was reused.
+	 * @param handle - local object handle.
+	 * @return object replication state reference.
+	 */
+	FObjectReplication& GetObjectReplication(const FObjectHandle& handle);
+
+	/**
+	 * @brief Get handles of local objects relevant for remote engine by the last replication frame (delta replication mode).
+	 * @return relevant object handles reference.
+	 */
+	std::vector<FObjectHandle>& GetRelevantObjectHandles();
+
+	/**
+	 * @brief Bind remote engine object handle to local object handle.
+	 * @param remoteHandle - remote object handle.
+	 * @param remoteClassID - remote class ID of the object.
+	 * @param localHandle - local object handle (invalid - object is not replicated locally).
+	 */
+	void BindRemoteObjectHandle(const FObjectHandle& remoteHandle, uint16_t remoteClassID, const FObjectHandle& localHandle);
+
+	/**
+	 * @brief Find local object handle bound to remote engine object handle.
+	 * @param remoteHandle - remote object handle.
+	 * @param remoteClassID - [out] remote class ID of the object.
+	 * @param localHandle - [out] local object handle.
+	 * @return true on success, false - handle is not bound or stale.
+	 */
+	bool FindRemoteObjectHandle(const FObjectHandle& remoteHandle, uint16_t& remoteClassID, FObjectHandle& localHandle) const;
+
+	/**
+	 * @brief Push event for remote engine. Lock-free, may be called from any thread.
 	 * @param event - event object.
 	 */
 	template <EEvent Event>
 	void PushEvent(const FEvent<Event>& event) 
 	{
-		_eventsFrame.Lock();
-		FOStream stream(_eventsFrame);
+		PushEventData(SerializeEvent(event));
+	}
+
+	/**
+	 * @brief Push serialized event for remote engine. Data is shared, it is copied to the events frame only on gathering.
+	 * Lock-free, may be called from any thread.
+	 * @param eventData - serialized event (see SerializeEvent()).
+	 */
+	void PushEventData(const FConstBufferPtr& eventData);
+
+	/**
+	 * @brief Serialize event into immutable block, which may be pushed to any number of remote engines.
+	 * @param event - event object.
+	 * @return serialized event.
+	 */
+	template <EEvent Event>
+	static FConstBufferPtr SerializeEvent(const FEvent<Event>& event)
+	{
+		FBufferPtr buffer = FBufferPtr(new FBuffer());
+		FOStream stream(*buffer);
 		stream << Event;
 		stream << event;
-		_eventsFrame.UnLock();
+		return buffer;
 	}
 
 private:
 
 	FGuid _GUID;
 	FBuffer _eventsFrame;
+	FLockFreeQueue<FConstBufferPtr> _pendingEvents;
+	FBuffer _replicationFrame;
+
+	std::atomic<uint32_t> _acknowledgedReplicationFrameIndex;
+	std::atomic<uint32_t> _recievedReplicationFrameIndex;
+	std::atomic<uint32_t> _acceptedCodecs;
+
+	std::vector<FClassSchemaMapping> _classSchemaMappings;
+
+	struct FObjectHandleBinding
+	{
+		FObjectHandle Handle;
+		uint32_t FrameIndex;
+	};
+
+	struct FRemoteObjectHandleBinding
+	{
+		FObjectHandle RemoteHandle;
+		uint16_t RemoteClassID;
+		FObjectHandle LocalHandle;
+	};
+
+	std::vector<FObjectHandleBinding> _objectHandleBindings;
+	std::vector<FObjectReplication> _objectReplications;
+	std::vector<FObjectHandle> _relevantObjectHandles;
+	std::vector<FRemoteObjectHandleBinding> _remoteObjectHandleBindings;
 
 };
 
@@ -0,0 +1,123 @@
+#include "../../Include/Common/NetworkBitStream.h"
+
+namespace gx {
+namespace network {
+
+FBitOStream::FBitOStream(FOStream& stream)
+	: _stream(stream)
+{
+}
+
+FBitOStream::~FBitOStream()
+{
+	Flush();
+}
+
+void FBitOStream::WriteBits(uint32_t value, uint32_t bitsCount)
+{
+	GX_NETWORK_ASSERT(bitsCount <= 32);
+	uint32_t mask = bitsCount == 32 ? 0xFFFFFFFF : (1u << bitsCount) - 1;
+	_scratch |= static_cast<uint64_t>(value & mask) << _scratchBits;
+	_scratchBits += bitsCount;
+	_bitsCount += bitsCount;
+	while (_scratchBits >= 8)
+	{
+		_stream << static_cast<uint8_t>(_scratch & 0xFF);
+		_scratch >>= 8;
+		_scratchBits -= 8;
+	}
+}
+
+void FBitOStream::WriteBool(bool value)
+{
+	WriteBits(value ? 1 : 0, 1);
+}
+
+void FBitOStream::WriteVarUInt(uint32_t value, uint32_t groupBits)
+{
+	GX_NETWORK_ASSERT(groupBits > 0 && groupBits < 32);
+	do
+	{
+		WriteBits(value, groupBits);
+		value >>= groupBits;
+		WriteBool(value != 0);
+	} while (value != 0);
+}
+
+void FBitOStream::Flush()
+{
+	if (_scratchBits > 0)
+	{
+		_stream << static_cast<uint8_t>(_scratch & 0xFF);
+		_bitsCount += 8 - _scratchBits;
+		_scratch = 0;
+		_scratchBits = 0;
+	}
+}
+
+uint32_t FBitOStream::GetBitsCount() const
+{
+	return _bitsCount;
+}
+
+FBitIStream::FBitIStream(FIStream& stream)
+	: _stream(stream)
+{
+}
+
+FBitIStream::~FBitIStream()
+{
+}
+
+uint32_t FBitIStream::ReadBits(uint32_t bitsCount)
+{
+	GX_NETWORK_ASSERT(bitsCount <= 32);
+	while (_scratchBits < bitsCount)
+	{
+		_scratch |= static_cast<uint64_t>(*_stream.Read(1)) << _scratchBits;
+		_scratchBits += 8;
+	}
+	uint32_t mask = bitsCount == 32 ? 0xFFFFFFFF : (1u << bitsCount) - 1;
+	uint32_t value = static_cast<uint32_t>(_scratch) & mask;
+	_scratch >>= bitsCount;
+	_scratchBits -= bitsCount;
+	_bitsCount += bitsCount;
+	return value;
+}
+
+bool FBitIStream::ReadBool()
+{
+	return ReadBits(1) != 0;
+}
+
+uint32_t FBitIStream::ReadVarUInt(uint32_t groupBits)
+{
+	GX_NETWORK_ASSERT(groupBits > 0 && groupBits < 32);
+	uint32_t value = 0;
+	uint32_t shift = 0;
+	do
+	{
+		uint32_t group = ReadBits(groupBits);
+		if (shift < 32)
+		{
+			value |= group << shift;
+		}
+		shift += groupBits;
+	} while (ReadBool());
+	return value;
+}
+
+void FBitIStream::Align()
+{
+	_bitsCount += _scratchBits;
+	_scratch = 0;
+	_scratchBits = 0;
+}
+
+uint32_t FBitIStream::GetBitsCount() const
+{
+	return _bitsCount;
+}
+
+}
+}
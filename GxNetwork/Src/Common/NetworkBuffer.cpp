@@ -1,11 +1,16 @@
 #include "../../Include/Common/NetworkBuffer.h"
 
-#include <iterator>
-
 namespace gx {
 namespace network {
 
 FBuffer::FBuffer(uint32_t capacity)
+	: _data(FBufferAllocator<uint8_t>(FBufferPool::GetDefault()))
+{
+	_data.reserve(capacity);
+}
+
+FBuffer::FBuffer(FBufferPool& pool, uint32_t capacity)
+	: _data(FBufferAllocator<uint8_t>(pool))
 {
 	_data.reserve(capacity);
 }
@@ -62,7 +67,7 @@ const uint8_t* FBuffer::Data() const
 
 void FBuffer::Append(const uint8_t* data, uint32_t size)
 {
-	std::copy(data, data + size, std::back_inserter(_data));
+	_data.insert(_data.end(), data, data + size);
 }
 
 void FBuffer::Insert(const uint8_t* data, uint32_t size, uint32_t position)
@@ -70,5 +75,39 @@ void FBuffer::Insert(const uint8_t* data, uint32_t size, uint32_t position)
 	_data.insert(_data.begin() + position, data, data + size);
 }
 
+FBufferView::FBufferView()
+	: _data(nullptr)
+	, _size(0)
+{
+}
+
+FBufferView::FBufferView(const uint8_t* data, uint32_t size)
+	: _data(data)
+	, _size(size)
+{
+}
+
+FBufferView::FBufferView(const FBuffer& buffer)
+	: _data(buffer.Data())
+	, _size(buffer.Size())
+{
+}
+
+const uint8_t* FBufferView::Data() const
+{
+	return _data;
+}
+
+uint32_t FBufferView::Size() const
+{
+	return _size;
+}
+
+FBufferView FBufferView::SubView(uint32_t offset, uint32_t size) const
+{
+	GX_NETWORK_ASSERT(offset + size <= _size);
+	return FBufferView(_data + offset, size);
+}
+
 }
 }
\ No newline at end of file
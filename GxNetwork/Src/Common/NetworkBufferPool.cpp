@@ -0,0 +1,163 @@
+#include "../../Include/Common/NetworkBufferPool.h"
+
+#include <new>
+
+namespace gx {
+namespace network {
+
+struct FBufferPool::FThreadCache
+{
+	enum { MaxBlocksPerSizeClass = 32 };
+
+	~FThreadCache()
+	{
+		if (Pool)
+		{
+			for (uint32_t sizeClass = 0; sizeClass < SizeClassesCount; ++sizeClass)
+			{
+				for (void* block : Blocks[sizeClass])
+					Pool->DeallocateShared(block, sizeClass);
+			}
+		}
+	}
+
+	FBufferPool* Pool = nullptr;
+	std::vector<void*> Blocks[SizeClassesCount];
+};
+
+FBufferPool::FBufferPool()
+{
+}
+
+FBufferPool::~FBufferPool()
+{
+	for (std::vector<void*>& blocks : _blocks)
+	{
+		for (void* block : blocks)
+			::operator delete(block);
+		blocks.clear();
+	}
+}
+
+void* FBufferPool::Allocate(size_t size)
+{
+	uint32_t sizeClass = GetSizeClass(size);
+	if (sizeClass == SizeClassesCount)
+		return ::operator new(size);
+
+	FThreadCache* cache = GetThreadCache();
+	if (cache && !cache->Blocks[sizeClass].empty())
+	{
+		void* block = cache->Blocks[sizeClass].back();
+		cache->Blocks[sizeClass].pop_back();
+		return block;
+	}
+
+	return AllocateShared(sizeClass);
+}
+
+void FBufferPool::Deallocate(void* block, size_t size)
+{
+	if (!block)
+		return;
+
+	uint32_t sizeClass = GetSizeClass(size);
+	if (sizeClass == SizeClassesCount)
+	{
+		::operator delete(block);
+		return;
+	}
+
+	FThreadCache* cache = GetThreadCache();
+	if (cache && cache->Blocks[sizeClass].size() < FThreadCache::MaxBlocksPerSizeClass)
+	{
+		cache->Blocks[sizeClass].push_back(block);
+		return;
+	}
+
+	DeallocateShared(block, sizeClass);
+}
+
+void FBufferPool::Trim()
+{
+	FThreadCache* cache = GetThreadCache();
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (uint32_t sizeClass = 0; sizeClass < SizeClassesCount; ++sizeClass)
+	{
+		if (cache)
+		{
+			for (void* block : cache->Blocks[sizeClass])
+				::operator delete(block);
+			cache->Blocks[sizeClass].clear();
+		}
+		for (void* block : _blocks[sizeClass])
+			::operator delete(block);
+		_blocks[sizeClass].clear();
+	}
+}
+
+FBufferPool& FBufferPool::GetDefault()
+{
+	// Never destroyed: thread caches return blocks on thread exit, which may happen after static destruction.
+	static FBufferPool* pool = []() {
+		FBufferPool* pool = new FBufferPool();
+		pool->_bThreadCache = true;
+		return pool;
+	}();
+	return *pool;
+}
+
+uint32_t FBufferPool::GetSizeClass(size_t size)
+{
+	if (size > GetBlockSize(SizeClassesCount - 1))
+		return SizeClassesCount;
+	uint32_t sizeClass = 0;
+	while (GetBlockSize(sizeClass) < size)
+		++sizeClass;
+	return sizeClass;
+}
+
+size_t FBufferPool::GetBlockSize(uint32_t sizeClass)
+{
+	return static_cast<size_t>(1) << (sizeClass + MinBlockSizeLog2);
+}
+
+FBufferPool::FThreadCache* FBufferPool::GetThreadCache()
+{
+	// Only default pool outlives every thread, custom pools use shared lists only.
+	if (!_bThreadCache)
+		return nullptr;
+	static thread_local FThreadCache cache;
+	cache.Pool = this;
+	return &cache;
+}
+
+void* FBufferPool::AllocateShared(uint32_t sizeClass)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_blocks[sizeClass].empty())
+		{
+			void* block = _blocks[sizeClass].back();
+			_blocks[sizeClass].pop_back();
+			return block;
+		}
+	}
+	return ::operator new(GetBlockSize(sizeClass));
+}
+
+void FBufferPool::DeallocateShared(void* block, uint32_t sizeClass)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if ((_blocks[sizeClass].size() + 1) * GetBlockSize(sizeClass) <= MaxCachedBytesPerSizeClass)
+		{
+			_blocks[sizeClass].push_back(block);
+			return;
+		}
+	}
+	::operator delete(block);
+}
+
+}
+}
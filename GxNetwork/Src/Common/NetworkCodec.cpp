@@ -0,0 +1,326 @@
+#include "../../Include/Common/NetworkCodec.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace gx {
+namespace network {
+
+FCodec::~FCodec()
+{
+
+}
+
+FLZCodec::FLZCodec()
+	: _dictionaryID(0)
+{
+
+}
+
+FLZCodec::FLZCodec(const FBufferView& dictionary)
+	: _dictionaryID(2166136261u)
+{
+	uint32_t size = dictionary.Size() < MaxOffset ? dictionary.Size() : MaxOffset;
+	_dictionary.assign(dictionary.Data() + dictionary.Size() - size, dictionary.Data() + dictionary.Size());
+
+	// FNV-1a of dictionary, both sides should share the same one.
+	for (uint8_t byte : _dictionary)
+		_dictionaryID = (_dictionaryID ^ byte) * 16777619u;
+
+	_dictionaryTable.resize(1 << HashBits, 0);
+	for (uint32_t pos = 0; pos + MinMatchSize <= size; ++pos)
+		_dictionaryTable[Hash(_dictionary.data() + pos)] = pos;
+}
+
+FLZCodec::~FLZCodec()
+{
+
+}
+
+ECodec FLZCodec::GetType() const
+{
+	return _dictionary.empty() ? ECodec::LZ : ECodec::LZDictionary;
+}
+
+// Compressed data semantic
+//
+// 1. Dictionary ID				| uint32_t (ECodec::LZDictionary only)
+// 2. Sequence[] until the end of data:
+//
+// Sequence semantic
+//
+// 1. Token						| uint8_t (high 4 bits - literals length, low 4 bits - match length - MinMatchSize)
+// 2. Literals length			| uint8_t[] (only if token length is 15: 255 while continued, then the rest)
+// 3. Literals					| uint8_t[]
+// 4. Match offset				| uint16_t (absent in the last sequence, may reach into dictionary)
+// 5. Match length				| uint8_t[] (only if token length is 15, the same as literals length)
+
+bool FLZCodec::Compress(const FBufferView& input, FBuffer& output) const
+{
+	const uint8_t* data = input.Data();
+	uint32_t size = input.Size();
+
+	// Positions are counted from the dictionary start, input follows the dictionary.
+	uint32_t dictionarySize = static_cast<uint32_t>(_dictionary.size());
+	uint32_t endPos = dictionarySize + size;
+
+	// Worst case: literals only with length extension.
+	output.Resize(size + size / 255 + 16 + sizeof(_dictionaryID));
+	uint8_t* out = output.Data();
+
+	if (dictionarySize != 0)
+	{
+		memcpy(out, &_dictionaryID, sizeof(_dictionaryID));
+		out += sizeof(_dictionaryID);
+	}
+
+	uint32_t table[1 << HashBits];
+	if (dictionarySize != 0)
+	{
+		memcpy(table, _dictionaryTable.data(), sizeof(table));
+	}
+	else
+	{
+		memset(table, 0, sizeof(table));
+	}
+
+	uint32_t literalsPos = dictionarySize;
+	uint32_t pos = dictionarySize;
+	while (pos + MinMatchSize <= endPos)
+	{
+		uint32_t hash = Hash(data + pos - dictionarySize);
+		uint32_t candidate = table[hash];
+		table[hash] = pos;
+
+		uint32_t matchSize = 0;
+		if (candidate < pos && pos - candidate <= MaxOffset)
+		{
+			while (pos + matchSize < endPos && *At(data, candidate + matchSize) == data[pos + matchSize - dictionarySize])
+				++matchSize;
+		}
+
+		if (matchSize < MinMatchSize)
+		{
+			++pos;
+			continue;
+		}
+
+		uint32_t literalsSize = pos - literalsPos;
+		uint32_t matchLength = matchSize - MinMatchSize;
+		*out++ = static_cast<uint8_t>(((literalsSize < 15 ? literalsSize : 15) << 4) | (matchLength < 15 ? matchLength : 15));
+		if (literalsSize >= 15)
+			out = WriteLength(out, literalsSize - 15);
+		memcpy(out, data + literalsPos - dictionarySize, literalsSize);
+		out += literalsSize;
+		uint16_t offset = static_cast<uint16_t>(pos - candidate);
+		*out++ = static_cast<uint8_t>(offset & 0xFF);
+		*out++ = static_cast<uint8_t>(offset >> 8);
+		if (matchLength >= 15)
+			out = WriteLength(out, matchLength - 15);
+
+		pos += matchSize;
+		literalsPos = pos;
+	}
+
+	uint32_t literalsSize = endPos - literalsPos;
+	*out++ = static_cast<uint8_t>((literalsSize < 15 ? literalsSize : 15) << 4);
+	if (literalsSize >= 15)
+		out = WriteLength(out, literalsSize - 15);
+	if (literalsSize != 0)
+	{
+		memcpy(out, data + literalsPos - dictionarySize, literalsSize);
+		out += literalsSize;
+	}
+
+	output.Resize(static_cast<uint32_t>(out - output.Data()));
+	return true;
+}
+
+bool FLZCodec::Decompress(const FBufferView& input, uint32_t size, FBuffer& output) const
+{
+	const uint8_t* in = input.Data();
+	const uint8_t* inEnd = in + input.Size();
+
+	uint32_t dictionarySize = static_cast<uint32_t>(_dictionary.size());
+	if (dictionarySize != 0)
+	{
+		uint32_t dictionaryID = 0;
+		if (input.Size() < sizeof(dictionaryID))
+			return false;
+		memcpy(&dictionaryID, in, sizeof(dictionaryID));
+		in += sizeof(dictionaryID);
+		if (dictionaryID != _dictionaryID)
+			return false;
+	}
+
+	// Size comes from remote side, it is checked before allocation. Input byte expands to 255 bytes at most (match length byte).
+	if (static_cast<uint64_t>(size) > static_cast<uint64_t>(input.Size()) * MaxExpansion)
+		return false;
+
+	output.Resize(size);
+	uint8_t* out = output.Data();
+	uint32_t pos = 0;
+
+	while (in < inEnd)
+	{
+		uint8_t token = *in++;
+
+		uint32_t literalsSize = token >> 4;
+		if (literalsSize == 15 && !ReadLength(in, inEnd, literalsSize))
+			return false;
+		if (literalsSize > static_cast<uint32_t>(inEnd - in) || literalsSize > size - pos)
+			return false;
+		if (literalsSize != 0)
+		{
+			memcpy(out + pos, in, literalsSize);
+			in += literalsSize;
+			pos += literalsSize;
+		}
+
+		if (in == inEnd)
+			break;
+
+		if (inEnd - in < 2)
+			return false;
+		uint32_t offset = in[0] | (static_cast<uint32_t>(in[1]) << 8);
+		in += 2;
+
+		uint32_t matchSize = token & 0x0F;
+		if (matchSize == 15 && !ReadLength(in, inEnd, matchSize))
+			return false;
+		matchSize += MinMatchSize;
+		if (offset == 0 || offset > dictionarySize + pos || matchSize > size - pos)
+			return false;
+
+		// Match may start in dictionary and overlap its own output, copied byte by byte.
+		uint32_t source = dictionarySize + pos - offset;
+		for (uint32_t i = 0; i < matchSize; ++i, ++pos, ++source)
+			out[pos] = source < dictionarySize ? _dictionary[source] : out[source - dictionarySize];
+	}
+
+	return pos == size;
+}
+
+void FLZCodec::TrainDictionary(const std::vector<FBufferView>& samples, uint32_t dictionarySize, FBuffer& dictionary)
+{
+	enum : uint32_t
+	{
+		GramSize = 6,
+		SegmentSize = 32,
+	};
+
+	std::vector<uint8_t> data;
+	for (const FBufferView& sample : samples)
+		data.insert(data.end(), sample.Data(), sample.Data() + sample.Size());
+
+	dictionary.Clear();
+	if (dictionarySize > MaxOffset)
+		dictionarySize = MaxOffset;
+	if (data.size() <= dictionarySize)
+	{
+		dictionary.Append(data.data(), GX_NETWORK_SIZE_T_TO_UINT_32_T(data.size()));
+		return;
+	}
+
+	auto gramAt = [&data](size_t pos) {
+		uint64_t gram = 0;
+		memcpy(&gram, data.data() + pos, GramSize);
+		return gram;
+	};
+
+	// Gram score is the count of samples it occurs in, so bytes repeated by every frame win over local repetitions.
+	std::unordered_map<uint64_t, uint32_t> scores;
+	{
+		size_t sampleStart = 0;
+		std::unordered_set<uint64_t> sampleGrams;
+		for (const FBufferView& sample : samples)
+		{
+			sampleGrams.clear();
+			for (size_t pos = sampleStart; pos + GramSize <= sampleStart + sample.Size(); ++pos)
+			{
+				if (sampleGrams.insert(gramAt(pos)).second)
+					++scores[gramAt(pos)];
+			}
+			sampleStart += sample.Size();
+		}
+	}
+
+	// Data is split into epochs, the best segment of every epoch is taken and its grams are not scored anymore.
+	size_t epochsCount = dictionarySize / SegmentSize;
+	if (epochsCount == 0)
+		return;
+	size_t epochSize = data.size() / epochsCount;
+	for (size_t epoch = 0; epoch < epochsCount && dictionary.Size() + SegmentSize <= dictionarySize; ++epoch)
+	{
+		size_t epochStart = epoch * epochSize;
+		size_t epochEnd = epochStart + epochSize;
+		if (epochEnd + SegmentSize > data.size())
+			epochEnd = data.size() - SegmentSize;
+
+		size_t bestPos = epochStart;
+		uint64_t bestScore = 0;
+		for (size_t pos = epochStart; pos < epochEnd; ++pos)
+		{
+			uint64_t score = 0;
+			for (size_t gram = pos; gram + GramSize <= pos + SegmentSize; ++gram)
+			{
+				auto item = scores.find(gramAt(gram));
+				score += item != scores.end() ? item->second : 0;
+			}
+			if (score > bestScore)
+			{
+				bestScore = score;
+				bestPos = pos;
+			}
+		}
+
+		// Grams met by a single sample only are not worth dictionary space.
+		if (bestScore <= SegmentSize - GramSize + 1)
+			continue;
+
+		for (size_t gram = bestPos; gram + GramSize <= bestPos + SegmentSize; ++gram)
+			scores.erase(gramAt(gram));
+		dictionary.Append(data.data() + bestPos, SegmentSize);
+	}
+}
+
+const uint8_t* FLZCodec::At(const uint8_t* data, uint32_t pos) const
+{
+	uint32_t dictionarySize = static_cast<uint32_t>(_dictionary.size());
+	return pos < dictionarySize ? _dictionary.data() + pos : data + pos - dictionarySize;
+}
+
+uint32_t FLZCodec::Hash(const uint8_t* data)
+{
+	uint32_t value;
+	memcpy(&value, data, sizeof(value));
+	return (value * 2654435761u) >> (32 - HashBits);
+}
+
+uint8_t* FLZCodec::WriteLength(uint8_t* output, uint32_t length)
+{
+	while (length >= 255)
+	{
+		*output++ = 255;
+		length -= 255;
+	}
+	*output++ = static_cast<uint8_t>(length);
+	return output;
+}
+
+bool FLZCodec::ReadLength(const uint8_t*& input, const uint8_t* end, uint32_t& length)
+{
+	uint8_t byte;
+	do
+	{
+		if (input == end)
+			return false;
+		byte = *input++;
+		length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+}
+}
@@ -0,0 +1,49 @@
+#include "../../Include/Common/NetworkSchema.h"
+
+namespace gx {
+namespace network {
+
+FIStream& operator>>(FIStream& stream, FPropertySchema& propertySchema)
+{
+	stream >> propertySchema.Name;
+	stream >> propertySchema.Type;
+	stream >> propertySchema.ElementType;
+	stream >> propertySchema.Encoding;
+	return stream;
+}
+
+FOStream& operator<<(FOStream& stream, const FPropertySchema& propertySchema)
+{
+	stream << propertySchema.Name;
+	stream << propertySchema.Type;
+	stream << propertySchema.ElementType;
+	stream << propertySchema.Encoding;
+	return stream;
+}
+
+FIStream& operator>>(FIStream& stream, FClassSchema& classSchema)
+{
+	stream >> classSchema.ClassName;
+	uint32_t propertiesCount = 0;
+	stream >> propertiesCount;
+	classSchema.Properties.resize(propertiesCount);
+	for (FPropertySchema& propertySchema : classSchema.Properties)
+	{
+		stream >> propertySchema;
+	}
+	return stream;
+}
+
+FOStream& operator<<(FOStream& stream, const FClassSchema& classSchema)
+{
+	stream << classSchema.ClassName;
+	stream << GX_NETWORK_SIZE_T_TO_UINT_32_T(classSchema.Properties.size());
+	for (const FPropertySchema& propertySchema : classSchema.Properties)
+	{
+		stream << propertySchema;
+	}
+	return stream;
+}
+
+}
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "../../Include/Common/NetworkStream.h"
 
+#include <cstring>
+
 namespace gx {
 namespace network {
 
@@ -20,11 +22,18 @@ void FStream::SetPos(uint32_t pos)
 
 FIStream::FIStream(const FBuffer& buffer)
 	: FStream()
-	, _buffer(buffer)
+	, _view(buffer)
 {
 	
 }
 
+FIStream::FIStream(const FBufferView& view)
+	: FStream()
+	, _view(view)
+{
+
+}
+
 FIStream::~FIStream()
 {
 	
@@ -32,18 +41,37 @@ FIStream::~FIStream()
 
 bool FIStream::IsEOF() const
 {
-	GX_NETWORK_ASSERT(_pos <= _buffer.Size());
-	return _pos == _buffer.Size();
+	GX_NETWORK_ASSERT(_pos <= _view.Size());
+	return _pos == _view.Size();
+}
+
+uint32_t FIStream::Remaining() const
+{
+	GX_NETWORK_ASSERT(_pos <= _view.Size());
+	return _view.Size() - _pos;
 }
 
 const uint8_t* FIStream::Read(uint32_t size)
 {
-	GX_NETWORK_ASSERT(_pos + size <= _buffer.Size());
-	const uint8_t* value = _buffer.Data() + _pos;
+	GX_NETWORK_ASSERT(_pos + size <= _view.Size());
+	const uint8_t* value = _view.Data() + _pos;
 	_pos += size;
 	return value;
 }
 
+uint32_t FIStream::ReadVarUInt()
+{
+	uint32_t value = 0;
+	for (uint32_t shift = 0; shift < 35; shift += 7)
+	{
+		uint8_t byte = *Read(1);
+		value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+			break;
+	}
+	return value;
+}
+
 FOStream::FOStream(FBuffer& buffer)
 	: FStream()
 	, _buffer(buffer)
@@ -58,9 +86,85 @@ FOStream::~FOStream()
 
 void FOStream::Write(const uint8_t* data, uint32_t size)
 {
-	_buffer.Insert(data, size, _pos);
+	// Writing at the end is by far the common case, append avoids tail shifting.
+	if (_pos == _buffer.Size())
+	{
+		_buffer.Append(data, size);
+	}
+	else
+	{
+		_buffer.Insert(data, size, _pos);
+	}
 	_pos += size;
 }
 
+void FOStream::Truncate(uint32_t pos)
+{
+	GX_NETWORK_ASSERT(pos <= _buffer.Size());
+	_buffer.Resize(pos);
+	_pos = pos;
+}
+
+void FOStream::WriteVarUInt(uint32_t value)
+{
+	uint8_t data[5];
+	uint32_t size = EncodeVarUInt(value, data);
+	Write(data, size);
+}
+
+uint32_t FOStream::ReserveSize(uint32_t sizeHint)
+{
+	uint32_t sizePos = _pos;
+	uint8_t data[MaxVarUIntSize];
+	uint32_t reservedSize = EncodeVarUInt(sizeHint, data);
+	// Zero padded with continuation bytes, so CommitSize() finds the reserved width.
+	for (uint32_t i = 1; i < reservedSize; ++i)
+	{
+		*this << static_cast<uint8_t>(0x80);
+	}
+	*this << static_cast<uint8_t>(0);
+	return sizePos;
+}
+
+uint32_t FOStream::CommitSize(uint32_t sizePos)
+{
+	GX_NETWORK_ASSERT(sizePos < _pos);
+	uint8_t* prefix = _buffer.Data() + sizePos;
+	uint32_t reservedSize = 1;
+	while (reservedSize < MaxVarUIntSize && (prefix[reservedSize - 1] & 0x80) != 0)
+	{
+		++reservedSize;
+	}
+	GX_NETWORK_ASSERT(sizePos + reservedSize <= _pos);
+	uint32_t size = _pos - sizePos - reservedSize;
+	uint8_t data[MaxVarUIntSize];
+	uint32_t prefixSize = EncodeVarUInt(size, data);
+	// Padded varint (continuation bytes with zero bits) is decoded as the same value.
+	for (; prefixSize < reservedSize; ++prefixSize)
+	{
+		data[prefixSize - 1] |= 0x80;
+		data[prefixSize] = 0;
+	}
+	memcpy(prefix, data, reservedSize);
+	if (prefixSize > reservedSize)
+	{
+		_buffer.Insert(data + reservedSize, prefixSize - reservedSize, sizePos + reservedSize);
+		_pos += prefixSize - reservedSize;
+	}
+	return size;
+}
+
+uint32_t FOStream::EncodeVarUInt(uint32_t value, uint8_t* data)
+{
+	uint32_t size = 0;
+	while (value >= 0x80)
+	{
+		data[size++] = static_cast<uint8_t>(value | 0x80);
+		value >>= 7;
+	}
+	data[size++] = static_cast<uint8_t>(value);
+	return size;
+}
+
 }
 }
\ No newline at end of file
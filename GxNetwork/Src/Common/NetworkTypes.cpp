@@ -1,5 +1,7 @@
 #include "../../Include/Common/NetworkTypes.h"
 
+#include <cstring>
+
 namespace gx {
 namespace network {
 
@@ -47,6 +49,33 @@ FGuid::FGuid(uint32_t a, uint32_t b, uint32_t c, uint32_t d)
 {
 }
 
+FObjectHandle::FObjectHandle()
+	: Value(InvalidValue)
+{
+}
+
+FObjectHandle::FObjectHandle(uint32_t index, uint32_t generation)
+	: Value(((generation & GenerationMask) << IndexBits) | (index & IndexMask))
+{
+	GX_NETWORK_ASSERT(index <= IndexMask);
+	GX_NETWORK_ASSERT(generation != 0 && generation <= GenerationMask);
+}
+
+uint32_t FObjectHandle::GetIndex() const
+{
+	return Value & IndexMask;
+}
+
+uint32_t FObjectHandle::GetGeneration() const
+{
+	return (Value >> IndexBits) & GenerationMask;
+}
+
+bool FObjectHandle::IsValid() const
+{
+	return GetGeneration() != 0;
+}
+
 bool operator==(const FVec3f& a, const FVec3f& b)
 {
 	return a.x == b.x && a.y == b.y && a.z == b.z;
@@ -83,6 +112,16 @@ bool operator!=(const FGuid& a, const FGuid& b)
 	return a.A != b.A || a.B != b.B || a.C != b.C || a.D != b.D;
 }
 
+bool operator==(const FObjectHandle& a, const FObjectHandle& b)
+{
+	return a.Value == b.Value;
+}
+
+bool operator!=(const FObjectHandle& a, const FObjectHandle& b)
+{
+	return a.Value != b.Value;
+}
+
 FIStream& operator>>(FIStream& stream, FGuid& GUID)
 {
 	stream >> GUID.A;
@@ -121,11 +160,56 @@ FOStream& operator<<(FOStream& stream, const FHeader& header)
 	return stream;
 }
 
+FStringView::FStringView()
+	: _data("")
+	, _size(0)
+{
+}
+
+FStringView::FStringView(const char* string)
+	: _data(string)
+	, _size(GX_NETWORK_SIZE_T_TO_UINT_32_T(strlen(string)))
+{
+}
+
+FStringView::FStringView(const char* string, uint32_t size)
+	: _data(string)
+	, _size(size)
+{
+	GX_NETWORK_ASSERT(_data[_size] == '\0');
+}
+
+const char* FStringView::Data() const
+{
+	return _data;
+}
+
+uint32_t FStringView::Size() const
+{
+	return _size;
+}
+
+FIStream& operator>>(FIStream& stream, FStringView& string)
+{
+	uint32_t  size = stream.ReadVarUInt();
+	const char* data = (const char*)(stream.Read(size));
+	// Malformed string (without terminator) is read as empty one.
+	string = size != 0 && data[size - 1] == '\0' ? FStringView(data, size - 1) : FStringView();
+	return stream;
+}
+
+FOStream& operator<<(FOStream& stream, const FStringView& string)
+{
+	uint32_t  size = string.Size() + 1;
+	stream.WriteVarUInt(size);
+	stream.Write((const uint8_t*)(string.Data()), size);
+	return stream;
+}
+
 FIStream& operator>>(FIStream& stream, std::string& string)
 {
 	static_assert(sizeof(char) == sizeof(uint8_t), "sizeof(char) != sizeof(uint8_t)");
-	uint32_t  size = 0;
-	stream >> size;
+	uint32_t  size = stream.ReadVarUInt();
 	string = (const char*)(stream.Read(size));
 	return stream;
 }
@@ -134,7 +218,7 @@ FOStream& operator<<(FOStream& stream, const std::string& string)
 {
 	static_assert(sizeof(char) == sizeof(uint8_t), "sizeof(char) != sizeof(uint8_t)");
 	uint32_t  size = GX_NETWORK_SIZE_T_TO_UINT_32_T(string.size() + 1);
-	stream << size;
+	stream.WriteVarUInt(size);
 	stream.Write((const uint8_t*)(string.c_str()), size);
 	return stream;
 }
@@ -34,22 +34,21 @@ public:
 	}
 
 	/**
-	 * @brief Find class creator by given class name.
-	 * @param className - class name.
-	 * @param creator - creator object.
-	 * @return true on found, false - otherwise.
+	 * @brief Get registered classes ordered by class ID.
+	 * Class ID is the index of class in ordered class names, so it is equal on engines sharing registered classes.
+	 * @param classNames - class names.
+	 * @param creators - class creators.
 	 */
-	bool FindClass(const char* className, FObject::FCreator& creator)
+	void GetClasses(std::vector<std::string>& classNames, std::vector<FObject::FCreator>& creators)
 	{
 		std::lock_guard<std::mutex> lock(_mutex);
-		auto item = std::find_if(_factory.begin(), _factory.end(), [className](const std::pair<std::string, FObject::FCreator>& item) {
-			return item.first == className;
-		});
-		if (item != _factory.end())
+		classNames.clear();
+		creators.clear();
+		for (const auto& item : _factory)
 		{
-			creator = item->second;
+			classNames.push_back(item.first);
+			creators.push_back(item.second);
 		}
-		return item != _factory.end();
 	}
 
 	/**
@@ -78,6 +77,167 @@ private:
 
 };
 
+/**
+ * @brief FRemotePropertyChunkWriter class. Writes chunked properties into remote engine replication frame.
+ * Chunk sent with frame is sent with every next frame till acknowledged, new chunks are added within frame budget.
+ */
+class FRemotePropertyChunkWriter : public FPropertyChunkWriter
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 * @param frameIndex - replication frame index.
+	 * @param acknowledgedFrameIndex - replication frame index acknowledged by remote engine.
+	 * @param budget - chunks data size per frame in bytes.
+	 */
+	FRemotePropertyChunkWriter(uint32_t frameIndex, uint32_t acknowledgedFrameIndex, uint32_t budget)
+		: _frameIndex(frameIndex)
+		, _acknowledgedFrameIndex(acknowledgedFrameIndex)
+		, _budget(budget)
+	{
+	}
+
+	/**
+	 * @brief Set replication state of object written next.
+	 * @param replication - object replication state.
+	 */
+	void SetObjectReplication(FRemoteEngine::FObjectReplication* replication)
+	{
+		_replication = replication;
+		_bPending = false;
+		_bInFlight = false;
+	}
+
+	/**
+	 * @brief Check if written object has chunks not acknowledged yet.
+	 * @return true if object should be sent with next frames, false - otherwise.
+	 */
+	bool IsPending() const
+	{
+		return _bPending;
+	}
+
+	/**
+	 * @brief Check if chunks of written object were sent.
+	 * @return true if object chunks were sent, false - otherwise.
+	 */
+	bool IsInFlight() const
+	{
+		return _bInFlight;
+	}
+
+	/**
+	 * @brief Forget chunks sent with previous frames, if object is not sent with current one.
+	 * @param replication - object replication state.
+	 */
+	static void Abort(FRemoteEngine::FObjectReplication& replication)
+	{
+		for (FRemoteEngine::FPropertyTransfer& transfer : replication.PropertyTransfers)
+		{
+			std::fill(transfer.ChunkFrameIndices.begin(), transfer.ChunkFrameIndices.end(), 0);
+		}
+	}
+
+	/**
+	 * @brief See FPropertyChunkWriter::WriteChunks().
+	 */
+	virtual bool WriteChunks(FOStream& stream, const FProperty& property) override
+	{
+		FRemoteEngine::FPropertyTransfer& transfer = GetPropertyTransfer(property.GetIndex());
+		const std::vector<uint32_t>& chunkRevisions = property.GetChunkRevisions();
+		uint32_t chunksCount = GX_NETWORK_SIZE_T_TO_UINT_32_T(chunkRevisions.size());
+		transfer.ChunkFrameIndices.resize(chunksCount, 0);
+		transfer.ChunkRevisions.resize(chunksCount, 0);
+
+		// Acknowledged frame carries chunks sent since, changed ones are sent again.
+		_chunks.clear();
+		for (uint32_t chunk = 0; chunk < chunksCount; ++chunk)
+		{
+			uint32_t& chunkFrameIndex = transfer.ChunkFrameIndices[chunk];
+			if (chunkFrameIndex != 0 && chunkFrameIndex <= _acknowledgedFrameIndex)
+			{
+				transfer.ChunkRevisions[chunk] = _acknowledgedFrameIndex;
+				chunkFrameIndex = 0;
+			}
+			if (chunkFrameIndex != 0)
+			{
+				AddChunk(property, chunk);
+			}
+		}
+
+		bool bComplete = true;
+		for (uint32_t chunk = 0; chunk < chunksCount; ++chunk)
+		{
+			uint32_t& chunkFrameIndex = transfer.ChunkFrameIndices[chunk];
+			if (chunkFrameIndex != 0 || chunkRevisions[chunk] <= transfer.ChunkRevisions[chunk])
+				continue;
+			if (_budget == 0)
+			{
+				bComplete = false;
+				break;
+			}
+			chunkFrameIndex = _frameIndex;
+			AddChunk(property, chunk);
+		}
+
+		_bPending = _bPending || !bComplete || !_chunks.empty();
+		_bInFlight = _bInFlight || !_chunks.empty();
+		if (_chunks.empty())
+			return false;
+
+		const std::vector<uint8_t>& data = property.GetRevisionData();
+		uint32_t size = GX_NETWORK_SIZE_T_TO_UINT_32_T(data.size());
+		stream.WriteVarUInt(size);
+		stream << bComplete;
+		stream.WriteVarUInt(GX_NETWORK_SIZE_T_TO_UINT_32_T(_chunks.size()));
+		for (uint32_t chunk : _chunks)
+		{
+			uint32_t chunkPos = chunk * FProperty::ChunkSize;
+			stream.WriteVarUInt(chunk);
+			stream.Write(data.data() + chunkPos, GetChunkSize(size, chunkPos));
+		}
+		return true;
+	}
+
+private:
+
+	FRemoteEngine::FPropertyTransfer& GetPropertyTransfer(uint32_t propertyIndex)
+	{
+		for (FRemoteEngine::FPropertyTransfer& transfer : _replication->PropertyTransfers)
+		{
+			if (transfer.PropertyIndex == propertyIndex)
+				return transfer;
+		}
+		_replication->PropertyTransfers.emplace_back();
+		_replication->PropertyTransfers.back().PropertyIndex = propertyIndex;
+		return _replication->PropertyTransfers.back();
+	}
+
+	void AddChunk(const FProperty& property, uint32_t chunk)
+	{
+		uint32_t chunkSize = GetChunkSize(GX_NETWORK_SIZE_T_TO_UINT_32_T(property.GetRevisionData().size()), chunk * FProperty::ChunkSize);
+		_budget = chunkSize < _budget ? _budget - chunkSize : 0;
+		_chunks.push_back(chunk);
+	}
+
+	static uint32_t GetChunkSize(uint32_t size, uint32_t chunkPos)
+	{
+		return size - chunkPos < FProperty::ChunkSize ? size - chunkPos : FProperty::ChunkSize;
+	}
+
+	uint32_t _frameIndex;
+	uint32_t _acknowledgedFrameIndex;
+	uint32_t _budget;
+
+	FRemoteEngine::FObjectReplication* _replication = nullptr;
+	bool _bPending = false;
+	bool _bInFlight = false;
+	std::vector<uint32_t> _chunks;
+
+};
+
 FEngine::FEngine(const FGuid& GUID, const FManagerPtr& manager)
 	: _GUID(GUID)
 	, _manager(manager)
@@ -94,6 +254,8 @@ bool FEngine::Init(EMode mode)
 	GX_NETWORK_ASSERT(_bInitialized == false);
 	_mode = mode;
 	_bInitialized = true;
+	BuildClassSchema();
+	_manager->SetClassSchema(_classSchema);
 	_bInitialized = _bInitialized && OnInit();
 	_bInitialized = _bInitialized && _manager->Init();
 	return _bInitialized;
@@ -104,11 +266,28 @@ void FEngine::Tick(float dt)
 	if (!CheckInitialized(__FUNCTION__))
 		return;
 
-	_replicationFrame.Lock();
-	_replicationFrame.Clear();
-	network::FOStream stream(_replicationFrame);
-	Replicate(stream);
-	_replicationFrame.UnLock();
+	++_replicationFrameIndex;
+	_replicationTime += dt;
+
+	UpdateReplicationSchedule();
+
+	if (_replicationMode == EReplicationMode::Full)
+	{
+		_replicationFrame.Lock();
+		_replicationFrame.Clear();
+		network::FOStream stream(_replicationFrame);
+		Replicate(stream);
+		_replicationFrame.UnLock();
+	}
+	else // _replicationMode == EReplicationMode::Delta
+	{
+		UpdateReplicationRevisions();
+		if (_relevancyPolicy)
+		{
+			UpdateRelevancyCandidates();
+		}
+		UpdateRemoteReplicationFrames();
+	}
 	OnTick(dt);
 }
 
@@ -116,7 +295,8 @@ void FEngine::Shutdown()
 {
 	GX_NETWORK_ASSERT(_bInitialized == true);
 	OnShutdown();
-	_objects.clear();
+	_objects.Clear();
+	_spatialGrid.Clear();
 	_manager->Shutdown();
 	_bInitialized = false;
 }
@@ -126,29 +306,154 @@ const FGuid& FEngine::GetGUID() const
 	return _GUID;
 }
 
+void FEngine::SetReplicationMode(EReplicationMode replicationMode)
+{
+	_replicationMode = replicationMode;
+}
+
+FEngine::EReplicationMode FEngine::GetReplicationMode() const
+{
+	return _replicationMode;
+}
+
+void FEngine::SetRelevancyPolicy(const FRelevancyPolicyPtr& relevancyPolicy)
+{
+	_relevancyPolicy = relevancyPolicy;
+}
+
+const FRelevancyPolicyPtr& FEngine::GetRelevancyPolicy() const
+{
+	return _relevancyPolicy;
+}
+
+void FEngine::SetReplicationBudget(uint32_t replicationBudget)
+{
+	_replicationBudget = replicationBudget;
+}
+
+uint32_t FEngine::GetReplicationBudget() const
+{
+	return _replicationBudget;
+}
+
+void FEngine::SetPropertyChunksBudget(uint32_t propertyChunksBudget)
+{
+	_propertyChunksBudget = propertyChunksBudget;
+}
+
+uint32_t FEngine::GetPropertyChunksBudget() const
+{
+	return _propertyChunksBudget;
+}
+
 void FEngine::Replicate(FIStream& stream)
+{
+	Replicate(stream, nullptr);
+}
+
+void FEngine::Replicate(FIStream& stream, const FRemoteEnginePtr& remoteEngine)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return;
 
+	uint32_t frameIndex = 0;
+	stream >> frameIndex;
+
+	bool bComplete = true;
+
 	while (!stream.IsEOF())
 	{
+		uint32_t handleValue = 0;
+		stream >> handleValue;
+
+		bool bBinding = (handleValue & ObjectHandleBindingFlag) != 0;
+
+		FObjectHandle remoteHandle;
+		remoteHandle.Value = handleValue & ~ObjectHandleBindingFlag;
+
 		FGuid GUID;
-		stream >> GUID;
+		uint16_t  classID = 0;
 
-		std::string className;
-		stream >> className;
+		if (bBinding)
+		{
+			stream >> GUID;
+			stream >> classID;
+		}
 
-		uint32_t  objectDataSize = 0;
-		stream >> objectDataSize;
+		uint32_t  objectDataSize = stream.ReadVarUInt();
 		
 		uint32_t  objectStartPos = stream.Pos();
 
+		if (!bBinding)
+		{
+			FObjectHandle localHandle;
+			if (!remoteEngine || !remoteEngine->FindRemoteObjectHandle(remoteHandle, classID, localHandle))
+			{
+				FLogger::PrintWarning(
+					"Unable to replicate object #",
+					remoteHandle.Value,
+					". Object handle is not bound.");
+				bComplete = false;
+				stream.SetPos(objectStartPos);
+				stream.Read(objectDataSize);
+				continue;
+			}
+			FObjectPtr object = GetObjectByHandle(localHandle);
+			// Object is not replicated locally or was removed already.
+			if (!object)
+			{
+				stream.SetPos(objectStartPos);
+				stream.Read(objectDataSize);
+				continue;
+			}
+			GUID = object->GetGUID();
+		}
+
+		uint16_t remoteClassID = classID;
+
+		const FClassSchemaMapping* classSchemaMapping = nullptr;
+
+		if (remoteEngine)
+		{
+			classSchemaMapping = remoteEngine->FindClassSchemaMapping(classID);
+			if (!classSchemaMapping)
+			{
+				FLogger::PrintWarning(
+					"Unable to replicate object #",
+					classID,
+					"[",
+					GUID.A,
+					"-",
+					GUID.B,
+					"-",
+					GUID.C,
+					"-",
+					GUID.D,
+					"]. Class schema not recieved.");
+				bComplete = false;
+				stream.SetPos(objectStartPos);
+				stream.Read(objectDataSize);
+				continue;
+			}
+			classID = classSchemaMapping->ClassID;
+			// Remote class is unknown locally, already reported on schema recieve.
+			if (classID == FClassSchemaMapping::InvalidClassID)
+			{
+				if (bBinding)
+				{
+					remoteEngine->BindRemoteObjectHandle(remoteHandle, remoteClassID, FObjectHandle());
+				}
+				stream.SetPos(objectStartPos);
+				stream.Read(objectDataSize);
+				continue;
+			}
+		}
+
 		FObjectPtr object = GetObjectByGUID(GUID);
 
 		if (object)
 		{
-			if (className != object->GetClassName())
+			if (classID != object->GetClassID())
 			{
 				FLogger::PrintWarning(
 					"Unable to replicate object <", 
@@ -161,20 +466,21 @@ void FEngine::Replicate(FIStream& stream)
 					GUID.C, 
 					"-", 
 					GUID.D, 
-					"]. Class name mismatch: <", 
-					className, ">.");
+					"]. Class mismatch: <", 
+					GetClassNameByID(classID), ">.");
+				object = nullptr;
 			}
 			else
 			{
 				if (_mode == EMode::Client)
 				{
-					stream >> object;
+					object->Replicate(stream, classSchemaMapping);
 				}
 				else // _mode == EMode::Server
 				{
 					if (object->GetNetworkRole() & FObject::ERole::RemoteAuthority)
 					{
-						stream >> object;
+						object->Replicate(stream, classSchemaMapping);
 					}
 				}
 			}			
@@ -185,7 +491,7 @@ void FEngine::Replicate(FIStream& stream)
 			{
 				FLogger::PrintError(
 					"Unable to replicate object <",
-					className,
+					GetClassNameByID(classID),
 					">[",
 					GUID.A,
 					"-",
@@ -198,54 +504,329 @@ void FEngine::Replicate(FIStream& stream)
 			}
 			else // _mode == EMode::Client
 			{
-				FObjectPtr object = CreateObjectStatic(GUID, className.c_str());
+				object = CreateObjectStaticByClassID(GUID, classID);
 
 				// Replicate immediately after creation.
 				// TODO: Experimental.
-				stream >> object;
-
 				if (object)
 				{
+					object->Replicate(stream, classSchemaMapping);
 					OnObjectCreated(object);
 				}				
 			}
 		}
+
+		// Binding is kept even if object is not replicated locally, so the handle is skipped later.
+		if (bBinding && remoteEngine)
+		{
+			remoteEngine->BindRemoteObjectHandle(remoteHandle, remoteClassID, object ? object->GetHandle() : FObjectHandle());
+		}
 		
 		stream.SetPos(objectStartPos);
 		stream.Read(objectDataSize);
 	}
+
+	// Frame is acknowledged only when it was applied completely.
+	if (remoteEngine && bComplete)
+	{
+		remoteEngine->SetRecievedReplicationFrameIndex(frameIndex);
+	}
 }
 
+// Frame semantic
+//
+// 1. Frame index				| uint32_t
+// 2. Objects					| Object[]
+//
 // Object semantic
 //
-// 1. Object GUID				| uint32_t[4]
-// 3. Object class name size	| uint32_t
-// 4. Object class name			| char[]
-// 5. Object data size			| uint32_t
-// 6. Object data				| uint8_t[]
+// 1. Object handle				| uint32_t (high bit - handle binding follows)
+// 2. Object GUID				| uint32_t[4] (handle binding only)
+// 3. Object class ID			| uint16_t (handle binding only)
+// 4. Object data size			| varuint
+// 5. Object data				| uint8_t[]
 
 void FEngine::Replicate(FOStream& stream) const
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return;
 
+	stream << _replicationFrameIndex;
+
 	for (const FObjectPtr& object : _objects)
 	{
-		if (object->GetNetworkRole() & FObject::ERole::Authority || object->GetNetworkRole() & FObject::ERole::RemoteAuthority)
+		if (IsReplicated(object))
 		{
+			// Shared frame, every object carries handle binding.
+			stream << (object->GetHandle().Value | ObjectHandleBindingFlag);
 			stream << object->GetGUID();
-			stream << std::string(object->GetClassName());
-			uint32_t objectStartPos = stream.Pos();
+			stream << object->GetClassID();
+			uint32_t objectSizePos = stream.ReserveSize(object->GetSizeHint(false) + FOStream::MaxVarUIntSize);
 			stream << object;
-			uint32_t objectDataSize = stream.Pos() - objectStartPos;
-			stream.SetPos(objectStartPos);
-			stream << objectDataSize;
-			stream.SetPos(objectStartPos + objectDataSize + sizeof(objectDataSize));
+			stream.CommitSize(objectSizePos);
 		}		
 	}
 }
 
+void FEngine::Replicate(FOStream& stream, const FRemoteEnginePtr& remoteEngine) const
+{
+	if (!CheckInitialized(__FUNCTION__))
+		return;
+
+	uint32_t baselineFrameIndex = remoteEngine->GetAcknowledgedReplicationFrameIndex();
+
+	uint32_t frameStartPos = stream.Pos();
+	stream << _replicationFrameIndex;
+	uint32_t objectsStartPos = stream.Pos();
+
+	// Relevancy policy able to gather candidates from spatial grid limits objects checked to the ones nearby.
+	std::vector<FObjectHandle> candidateHandles;
+	bool bCandidates = false;
+	if (_relevancyPolicy)
+	{
+		_relevancyPolicy->BeginFrame(*this, remoteEngine);
+		bCandidates = _relevancyPolicy->GatherCandidates(*this, remoteEngine, candidateHandles);
+	}
+
+	// Replication state is looked up again on writing, since state storage may grow while candidates are collected.
+	struct FCandidate
+	{
+		FObject* Object;
+		uint32_t BaselineFrameIndex;
+		float Priority;
+		bool bBound;
+		bool bTransferInFlight;
+	};
+
+	std::vector<FCandidate> candidates;
+	candidates.reserve(bCandidates ? candidateHandles.size() + _unlocatedObjects.size() : _objects.Size());
+	std::vector<FObjectHandle> checkedHandles;
+
+	// Chunks take at most half of the frame budget, the rest is left for objects changes.
+	uint32_t propertyChunksBudget = _propertyChunksBudget;
+	if (_replicationBudget != 0 && propertyChunksBudget > _replicationBudget / 2)
+	{
+		propertyChunksBudget = _replicationBudget / 2;
+	}
+	FRemotePropertyChunkWriter chunkWriter(_replicationFrameIndex, baselineFrameIndex, propertyChunksBudget);
+
+	auto dropRelevancy = [&remoteEngine](const FObjectHandle& handle, FRemoteEngine::FObjectReplication& replication)
+	{
+		replication.RelevancyFrameIndex = 0;
+		// Binding not acknowledged yet is not carried by frames without the object.
+		remoteEngine->ResetObjectHandleBindingFrame(handle);
+		if (replication.bTransferInFlight)
+		{
+			FRemotePropertyChunkWriter::Abort(replication);
+			replication.bTransferInFlight = false;
+		}
+	};
+
+	auto collect = [&](const FObjectPtr& object)
+	{
+		if (!IsReplicated(object))
+			return;
+
+		const FObjectHandle& handle = object->GetHandle();
+		FRemoteEngine::FObjectReplication& replication = remoteEngine->GetObjectReplication(handle);
+		uint32_t objectBaselineFrameIndex = baselineFrameIndex;
+
+		if (_relevancyPolicy)
+		{
+			if (replication.bChecked)
+				return;
+			replication.bChecked = true;
+			checkedHandles.push_back(handle);
+		}
+
+		// Dormant object with acknowledged state is skipped as is, relevancy changes do not resend it.
+		if (object->_bDormant && IsDormancyAcknowledged(object, remoteEngine))
+			return;
+
+		if (_relevancyPolicy)
+		{
+			if (!IsRelevant(object, remoteEngine))
+			{
+				dropRelevancy(handle, replication);
+				return;
+			}
+			if (replication.RelevancyFrameIndex == 0)
+			{
+				replication.RelevancyFrameIndex = _replicationFrameIndex;
+			}
+			// Changes made while object was not relevant were never sent, full state goes till relevancy frame is acknowledged.
+			if (replication.RelevancyFrameIndex > baselineFrameIndex)
+			{
+				objectBaselineFrameIndex = 0;
+			}
+		}
+
+		// Acknowledged frames after deferral may miss object changes, so deferral baseline holds till the covering frame is acknowledged.
+		if (replication.bDeferred)
+		{
+			if (replication.CoverFrameIndex != 0 && replication.CoverFrameIndex <= baselineFrameIndex)
+			{
+				replication.bDeferred = false;
+			}
+			else if (replication.DeferredBaselineFrameIndex < objectBaselineFrameIndex)
+			{
+				objectBaselineFrameIndex = replication.DeferredBaselineFrameIndex;
+			}
+		}
+
+		bool bBound = remoteEngine->IsObjectHandleBound(handle);
+
+		if (bBound && object->GetRevision() <= objectBaselineFrameIndex && !replication.bTransferPending)
+			return;
+
+		if (_replicationBudget != 0)
+		{
+			replication.Priority += GetReplicationPriority(object, remoteEngine);
+		}
+
+		candidates.push_back({ object.get(), objectBaselineFrameIndex, replication.Priority, bBound, replication.bTransferInFlight });
+	};
+
+	if (bCandidates)
+	{
+		// Always relevant objects of the grid come with unlocated ones.
+		for (const FObjectHandle& handle : candidateHandles)
+		{
+			FObjectPtr object = _objects.Find(handle);
+			if (object && !object->IsAlwaysRelevant())
+			{
+				collect(object);
+			}
+		}
+		for (const FObjectHandle& handle : _unlocatedObjects)
+		{
+			FObjectPtr object = _objects.Find(handle);
+			if (object && (object->IsAlwaysRelevant() || !_spatialGrid.Contains(handle)))
+			{
+				collect(object);
+			}
+		}
+	}
+	else
+	{
+		for (const FObjectPtr& object : _objects)
+		{
+			collect(object);
+		}
+	}
+
+	if (_relevancyPolicy)
+	{
+		std::vector<FObjectHandle>& relevantHandles = remoteEngine->GetRelevantObjectHandles();
+
+		// Objects relevant by the previous frame, which are not checked by this one, dropped out of relevancy.
+		for (const FObjectHandle& handle : relevantHandles)
+		{
+			FObjectPtr object = _objects.Find(handle);
+			if (!object)
+				continue;
+			FRemoteEngine::FObjectReplication& replication = remoteEngine->GetObjectReplication(handle);
+			if (replication.bChecked)
+				continue;
+			// Dormant object with acknowledged state keeps its relevancy till it is woken.
+			if (object->_bDormant && IsDormancyAcknowledged(object, remoteEngine))
+			{
+				replication.bChecked = true;
+				checkedHandles.push_back(handle);
+				continue;
+			}
+			dropRelevancy(handle, replication);
+		}
+
+		relevantHandles.clear();
+		for (const FObjectHandle& handle : checkedHandles)
+		{
+			FRemoteEngine::FObjectReplication& replication = remoteEngine->GetObjectReplication(handle);
+			replication.bChecked = false;
+			if (replication.RelevancyFrameIndex != 0)
+			{
+				relevantHandles.push_back(handle);
+			}
+		}
+	}
+
+	// Objects waiting the longest with the highest priority go first, the rest is deferred once budget is spent.
+	// Objects with chunks sent go before, deferral would drop chunks sent since the last acknowledged frame.
+	if (_replicationBudget != 0)
+	{
+		std::stable_sort(candidates.begin(), candidates.end(), [](const FCandidate& a, const FCandidate& b) {
+			return a.bTransferInFlight != b.bTransferInFlight ? a.bTransferInFlight : a.Priority > b.Priority;
+		});
+	}
+
+	for (const FCandidate& candidate : candidates)
+	{
+		const FObjectHandle& handle = candidate.Object->GetHandle();
+		uint32_t objectStartPos = stream.Pos();
+
+		if (candidate.bBound)
+		{
+			stream << handle.Value;
+		}
+		else
+		{
+			stream << (handle.Value | ObjectHandleBindingFlag);
+			stream << candidate.Object->GetGUID();
+			stream << candidate.Object->GetClassID();
+		}
+
+		FRemoteEngine::FObjectReplication& replication = remoteEngine->GetObjectReplication(handle);
+
+		uint32_t objectSizePos = stream.ReserveSize(candidate.Object->GetDeltaSizeHint(candidate.BaselineFrameIndex, true) + FOStream::MaxVarUIntSize);
+		chunkWriter.SetObjectReplication(&replication);
+		candidate.Object->ReplicateDelta(stream, candidate.BaselineFrameIndex, &chunkWriter);
+		stream.CommitSize(objectSizePos);
+
+		// At least one object goes into the frame, even if it alone exceeds the budget.
+		if (_replicationBudget != 0 && stream.Pos() - frameStartPos > _replicationBudget && objectStartPos != objectsStartPos)
+		{
+			stream.Truncate(objectStartPos);
+			// Frames since binding one should carry the binding till it is acknowledged.
+			if (!candidate.bBound)
+			{
+				remoteEngine->ResetObjectHandleBindingFrame(handle);
+			}
+			if (!replication.bDeferred)
+			{
+				replication.bDeferred = true;
+				replication.DeferredBaselineFrameIndex = candidate.BaselineFrameIndex;
+			}
+			replication.CoverFrameIndex = 0;
+			if (chunkWriter.IsPending())
+			{
+				FRemotePropertyChunkWriter::Abort(replication);
+				replication.bTransferPending = true;
+				replication.bTransferInFlight = false;
+			}
+			continue;
+		}
+
+		replication.bTransferPending = chunkWriter.IsPending();
+		replication.bTransferInFlight = chunkWriter.IsInFlight();
+
+		if (!candidate.bBound)
+		{
+			remoteEngine->SetObjectHandleBindingFrame(handle, _replicationFrameIndex);
+		}
+		if (replication.bDeferred)
+		{
+			replication.CoverFrameIndex = _replicationFrameIndex;
+		}
+		replication.Priority = 0.0f;
+	}
+}
+
 void FEngine::ReplicateEvents(FIStream& stream)
+{
+	ReplicateEvents(stream, nullptr);
+}
+
+void FEngine::ReplicateEvents(FIStream& stream, const FRemoteEnginePtr& remoteEngine)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return;
@@ -269,7 +850,13 @@ void FEngine::ReplicateEvents(FIStream& stream)
 				{
 					FEvent<EEvent::CreateObject> event;
 					stream >> event;
-					result = result && ProcessEventCreateObject(event.GUID, event.OwnerGUID, event.ClassName.c_str());
+					uint16_t classID = event.ClassID;
+					if (remoteEngine)
+					{
+						const FClassSchemaMapping* classSchemaMapping = remoteEngine->FindClassSchemaMapping(classID);
+						classID = classSchemaMapping ? classSchemaMapping->ClassID : static_cast<uint16_t>(FClassSchemaMapping::InvalidClassID);
+					}
+					result = result && ProcessEventCreateObject(event.GUID, event.OwnerGUID, classID);
 					break;
 				}
 
@@ -285,9 +872,16 @@ void FEngine::ReplicateEvents(FIStream& stream)
 				{
 					FEvent<EEvent::ExecFunctionRemote> event;
 					stream >> event;
-					FBuffer parameters;
-					parameters.Append(event.ParametersData, event.ParametersSize);
-					result = result && ProcessEventExecFunctionRemote(event.GUID, event.FunctionName.c_str(), parameters);
+					FBufferView parameters(event.ParametersData, event.ParametersSize);
+					result = result && ProcessEventExecFunctionRemote(event.GUID, event.FunctionName.Data(), parameters);
+					break;
+				}
+
+				case EEvent::ClassSchema:
+				{
+					FEvent<EEvent::ClassSchema> event;
+					stream >> event;
+					result = result && ProcessEventClassSchema(event.Classes, remoteEngine);
 					break;
 				}
 
@@ -312,7 +906,15 @@ void FEngine::PlayerJoinGame(const FGuid& playerGUID)
 
 	if (_mode == EMode::Server)
 	{
-		CreateObjectDynamic(playerGUID, playerGUID, "CharacterActor");
+		uint16_t classID = 0;
+		if (FindClassID("CharacterActor", classID))
+		{
+			CreateObjectDynamic(playerGUID, playerGUID, classID);
+		}
+		else
+		{
+			FLogger::PrintError("Unable to join game. Class <CharacterActor> not found.");
+		}
 	}
 	else // _mode == EMode::Client
 	{
@@ -345,16 +947,19 @@ const FBuffer& FEngine::GetReplicationFrame() const
 	return _replicationFrame;
 }
 
+uint32_t FEngine::GetReplicationFrameIndex() const
+{
+	return _replicationFrameIndex;
+}
+
 FObjectPtr FEngine::GetObjectByGUID(const FGuid& GUID) const
 {
-	for (const FObjectPtr& object : _objects)
-	{
-		if (object->GetGUID() == GUID)
-		{
-			return object;
-		}
-	}
-	return nullptr;
+	return _objects.Find(GUID);
+}
+
+FObjectPtr FEngine::GetObjectByHandle(const FObjectHandle& handle) const
+{
+	return _objects.Find(handle);
 }
 
 FManagerPtr FEngine::GetNetworkManager() const
@@ -362,12 +967,64 @@ FManagerPtr FEngine::GetNetworkManager() const
 	return _manager;
 }
 
+const std::vector<FClassSchema>& FEngine::GetClassSchema() const
+{
+	return _classSchema;
+}
+
 bool FEngine::RegisterClass(const char* className, const FObject::FCreator& creator)
 {
 	return FEngineClassFactory::Instance().RegisterClass(className, creator);
 }
 
+bool FEngine::FindClassID(const char* className, uint16_t& classID) const
+{
+	auto item = _classIDs.find(className);
+	if (item != _classIDs.end())
+	{
+		classID = item->second;
+	}
+	return item != _classIDs.end();
+}
+
+FSpatialGrid& FEngine::GetSpatialGrid()
+{
+	return _spatialGrid;
+}
+
+const FSpatialGrid& FEngine::GetSpatialGrid() const
+{
+	return _spatialGrid;
+}
+
 FObjectPtr FEngine::CreateObjectStatic(const FGuid& GUID, const char* className)
+{
+	if (!CheckInitialized(__FUNCTION__))
+		return nullptr;
+
+	uint16_t classID = 0;
+
+	if (!FindClassID(className, classID))
+	{
+		FLogger::PrintError(
+			"Unable to create object '", 
+			className, 
+			"' ",
+			GUID.A, 
+			"-", 
+			GUID.B, 
+			"-", 
+			GUID.C, 
+			"-", 
+			GUID.D, 
+			". Class not found.");
+		return nullptr;
+	}
+
+	return CreateObjectStaticByClassID(GUID, classID);
+}
+
+FObjectPtr FEngine::CreateObjectStaticByClassID(const FGuid& GUID, uint16_t classID)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return nullptr;
@@ -383,11 +1040,11 @@ FObjectPtr FEngine::CreateObjectStatic(const FGuid& GUID, const char* className)
 		role = FObject::ERole::Authority | FObject::ERole::RemoteProxy;
 	}
 
-	FObjectPtr object = CreateObjectByClassName(GUID, className, role);
+	FObjectPtr object = CreateObjectByClassID(GUID, classID, role);
 
 	if (object && _mode == EMode::Server)
 	{
-		BroadcastEventCreateObject(GUID, this->_GUID, className);
+		BroadcastEventCreateObject(GUID, this->_GUID, classID);
 	}
 
 	return object;
@@ -408,7 +1065,7 @@ FObjectPtr FEngine::RemoveObjectStatic(const FGuid& GUID)
 	return object;
 }
 
-FObjectPtr FEngine::CreateObjectDynamic(const FGuid& GUID, const FGuid& ownerGUID, const char* className)
+FObjectPtr FEngine::CreateObjectDynamic(const FGuid& GUID, const FGuid& ownerGUID, uint16_t classID)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return nullptr;
@@ -438,14 +1095,14 @@ FObjectPtr FEngine::CreateObjectDynamic(const FGuid& GUID, const FGuid& ownerGUI
 		}
 	}
 
-	FObjectPtr object = CreateObjectByClassName(GUID, className, role);
+	FObjectPtr object = CreateObjectByClassID(GUID, classID, role);
 
 	if (object)
 	{
 		OnObjectCreated(object);
 		if (_mode == EMode::Server)
 		{
-			BroadcastEventCreateObject(GUID, ownerGUID, className);
+			BroadcastEventCreateObject(GUID, ownerGUID, classID);
 		}
 	}
 
@@ -471,7 +1128,7 @@ FObjectPtr FEngine::RemoveObjectDynamic(const FGuid& GUID)
 	return object;
 }
 
-bool FEngine::ProcessEventExecFunctionRemote(const FGuid& GUID, const char* name, const FBuffer& parameters)
+bool FEngine::ProcessEventExecFunctionRemote(const FGuid& GUID, const char* name, const FBufferView& parameters)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return false;
@@ -489,13 +1146,100 @@ void FEngine::BroadcastEventExecFunctionRemote(const FGuid& GUID, const char* na
 		return;
 	FEvent<EEvent::ExecFunctionRemote> execFunctionRemoteEvent;
 	execFunctionRemoteEvent.GUID = GUID;
-	execFunctionRemoteEvent.FunctionName = name;
+	execFunctionRemoteEvent.FunctionName = FStringView(name);
 	execFunctionRemoteEvent.ParametersSize = parameters.Size();
 	execFunctionRemoteEvent.ParametersData = parameters.Data();
 	_manager->BroadcastEvent(execFunctionRemoteEvent);
 }
 
-bool FEngine::ProcessEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, const char* className)
+void FEngine::BuildClassSchema()
+{
+	std::vector<std::string> classNames;
+	FEngineClassFactory::Instance().GetClasses(classNames, _classCreators);
+	GX_NETWORK_ASSERT(_classCreators.size() < FClassSchemaMapping::InvalidClassID);
+	_classSchema.clear();
+	_classIDs.clear();
+	for (uint16_t classID = 0; classID < _classCreators.size(); ++classID)
+	{
+		FClassSchema classSchema;
+		classSchema.ClassName = classNames[classID];
+		_classIDs[classSchema.ClassName] = classID;
+		// Properties are registered by instance, so schema is taken from class default object.
+		FObjectPtr object = _classCreators[classID](this, FGuid(), FObject::ERole::Authority | FObject::ERole::RemoteProxy);
+		if (!object)
+		{
+			_classSchema.push_back(classSchema);
+			continue;
+		}
+		for (uint32_t i = 0; i < object->GetPropertyCount(); ++i)
+		{
+			const FProperty* property = object->GetPropertyByIndex(i);
+			FPropertySchema propertySchema;
+			propertySchema.Name = property->GetName();
+			propertySchema.Type = static_cast<uint8_t>(property->GetType());
+			propertySchema.Encoding = static_cast<uint8_t>(property->GetEncoding());
+			if (property->GetType() == FProperty::EType::Vector)
+			{
+				propertySchema.ElementType = static_cast<uint8_t>(static_cast<const FVectorProperty*>(property)->GetElementType());
+			}
+			classSchema.Properties.push_back(propertySchema);
+		}
+		_classSchema.push_back(classSchema);
+	}
+}
+
+bool FEngine::ProcessEventClassSchema(const std::vector<FClassSchema>& classes, const FRemoteEnginePtr& remoteEngine)
+{
+	if (!CheckInitialized(__FUNCTION__))
+		return false;
+
+	if (!remoteEngine)
+		return true;
+
+	std::vector<FClassSchemaMapping> classSchemaMappings(classes.size());
+
+	for (size_t remoteClassID = 0; remoteClassID < classes.size(); ++remoteClassID)
+	{
+		const FClassSchema& remoteClassSchema = classes[remoteClassID];
+		uint16_t classID = 0;
+		if (!FindClassID(remoteClassSchema.ClassName.c_str(), classID))
+		{
+			FLogger::PrintWarning("Remote class <", remoteClassSchema.ClassName, "> not found.");
+			continue;
+		}
+		const FClassSchema* localClassSchema = &_classSchema[classID];
+		FClassSchemaMapping& classSchemaMapping = classSchemaMappings[remoteClassID];
+		classSchemaMapping.ClassID = classID;
+		for (const FPropertySchema& remotePropertySchema : remoteClassSchema.Properties)
+		{
+			auto localPropertySchema = std::find_if(localClassSchema->Properties.begin(), localClassSchema->Properties.end(), [&remotePropertySchema](const FPropertySchema& item) {
+				return item.Name == remotePropertySchema.Name && 
+					item.Type == remotePropertySchema.Type && 
+					item.ElementType == remotePropertySchema.ElementType && 
+					item.Encoding == remotePropertySchema.Encoding;
+			});
+			if (localPropertySchema == localClassSchema->Properties.end())
+			{
+				FLogger::PrintWarning(
+					"Remote property '",
+					remotePropertySchema.Name,
+					"' of class <",
+					remoteClassSchema.ClassName,
+					"> not found or type mismatch.");
+				classSchemaMapping.Properties.push_back(FClassSchemaMapping::InvalidPropertyID);
+			}
+			else
+			{
+				classSchemaMapping.Properties.push_back(static_cast<uint8_t>(localPropertySchema - localClassSchema->Properties.begin()));
+			}
+		}
+	}
+
+	remoteEngine->SetClassSchemaMappings(std::move(classSchemaMappings));
+	return true;
+}
+
+bool FEngine::ProcessEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, uint16_t classID)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return nullptr;
@@ -506,7 +1250,7 @@ bool FEngine::ProcessEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID
 	{
 		FLogger::PrintError(
 			"Access denied (create object dynamic on server side <",
-			className,
+			GetClassNameByID(classID),
 			">[",
 			GUID.A,
 			"-",
@@ -527,7 +1271,7 @@ bool FEngine::ProcessEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID
 	}
 	else // _mode == EMode::Client
 	{
-		object = CreateObjectDynamic(GUID, ownerGUID, className);
+		object = CreateObjectDynamic(GUID, ownerGUID, classID);
 	}
 
 	return object != nullptr;
@@ -562,7 +1306,7 @@ bool FEngine::ProcessEventRemoveObject(const FGuid& GUID)
 	return object != nullptr;
 }
 
-void FEngine::BroadcastEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, const char* className)
+void FEngine::BroadcastEventCreateObject(const FGuid& GUID, const FGuid& ownerGUID, uint16_t classID)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return;
@@ -570,7 +1314,7 @@ void FEngine::BroadcastEventCreateObject(const FGuid& GUID, const FGuid& ownerGU
 	GX_NETWORK_ASSERT(_mode == EMode::Server);
 	FEvent<EEvent::CreateObject> createObjectEvent;
 	createObjectEvent.GUID = GUID;
-	createObjectEvent.ClassName = className;
+	createObjectEvent.ClassID = classID;
 	createObjectEvent.OwnerGUID = ownerGUID;
 	_manager->BroadcastEvent(createObjectEvent);
 }
@@ -593,19 +1337,117 @@ bool FEngine::CheckInitialized(const char* context) const
 	return _bInitialized;
 }
 
-FObjectPtr FEngine::CreateObjectByClassName(const FGuid& GUID, const char* className, uint16_t role)
+bool FEngine::IsReplicated(const FObjectPtr& object) const
+{
+	return object->GetNetworkRole() & FObject::ERole::Authority || object->GetNetworkRole() & FObject::ERole::RemoteAuthority;
+}
+
+bool FEngine::IsRelevant(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) const
+{
+	return object->IsAlwaysRelevant() || _relevancyPolicy->IsRelevant(object, remoteEngine);
+}
+
+bool FEngine::IsDormancyAcknowledged(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) const
+{
+	const FRemoteEngine::FObjectReplication& replication = remoteEngine->GetObjectReplication(object->GetHandle());
+	uint32_t baselineFrameIndex = remoteEngine->GetAcknowledgedReplicationFrameIndex();
+	if (object->GetRevision() > baselineFrameIndex || replication.bDeferred || replication.bTransferPending)
+		return false;
+	if (_relevancyPolicy && (replication.RelevancyFrameIndex == 0 || replication.RelevancyFrameIndex > baselineFrameIndex))
+		return false;
+	return remoteEngine->IsObjectHandleBound(object->GetHandle());
+}
+
+float FEngine::GetReplicationPriority(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) const
+{
+	float priority = object->GetReplicationPriority();
+	return _relevancyPolicy ? priority * _relevancyPolicy->GetPriorityScale(object, remoteEngine) : priority;
+}
+
+void FEngine::UpdateReplicationSchedule()
+{
+	for (const FObjectPtr& object : _objects)
+	{
+		float frequency = object->GetReplicationFrequency();
+		if (_replicationMode == EReplicationMode::Full)
+		{
+			// Shared frame is rebuilt every tick and may be requested at any tick, so it holds every object.
+			object->_bReplicationDue = true;
+		}
+		else if (object->_bDormant)
+		{
+			// Dormant object is woken by changes only, object without replicated state yet is woken as well.
+			object->_bReplicationDue = object->IsDirty() || object->GetRevision() == 0;
+		}
+		else if (frequency <= 0.0f)
+		{
+			object->_bReplicationDue = true;
+		}
+		else
+		{
+			object->_bReplicationDue = _replicationTime >= object->_nextReplicationTime;
+			if (object->_bReplicationDue)
+			{
+				object->_nextReplicationTime = _replicationTime + 1.0 / frequency;
+			}
+		}
+	}
+}
+
+void FEngine::UpdateReplicationRevisions()
+{
+	for (const FObjectPtr& object : _objects)
+	{
+		// Dirty bits of objects waiting for their interval are kept, so changes are revisioned together later.
+		if (IsReplicated(object) && object->_bReplicationDue)
+		{
+			object->UpdateRevision(_replicationFrameIndex, _replicationScratch);
+		}
+	}
+}
+
+void FEngine::UpdateRelevancyCandidates()
+{
+	_unlocatedObjects.clear();
+	for (const FObjectPtr& object : _objects)
+	{
+		if (IsReplicated(object) && (object->IsAlwaysRelevant() || !_spatialGrid.Contains(object->GetHandle())))
+		{
+			_unlocatedObjects.push_back(object->GetHandle());
+		}
+	}
+}
+
+void FEngine::UpdateRemoteReplicationFrames()
+{
+	for (const FRemoteEnginePtr& remoteEngine : _manager->GetRemoteEngines())
+	{
+		FBuffer& frame = remoteEngine->GetReplicationFrame();
+		frame.Lock();
+		frame.Clear();
+		FOStream stream(frame);
+		// Remote engine without acknowledged frames gets full snapshot.
+		Replicate(stream, remoteEngine);
+		frame.UnLock();
+	}
+}
+
+const char* FEngine::GetClassNameByID(uint16_t classID) const
+{
+	return classID < _classSchema.size() ? _classSchema[classID].ClassName.c_str() : "";
+}
+
+FObjectPtr FEngine::CreateObjectByClassID(const FGuid& GUID, uint16_t classID, uint16_t role)
 {
 	if (!CheckInitialized(__FUNCTION__))
 		return nullptr;
 
-	FObject::FCreator creator = nullptr;
-
-	if (!FEngineClassFactory::Instance().FindClass(className, creator))
+	if (classID >= _classCreators.size())
 	{
 		FLogger::PrintError(
-			"Unable to create object '", 
-			className, 
-			"' ",
+			"Unable to create object #", 
+			classID, 
+			" ",
 			GUID.A, 
 			"-", 
 			GUID.B, 
@@ -621,7 +1463,7 @@ FObjectPtr FEngine::CreateObjectByClassName(const FGuid& GUID, const char* class
 	{
 		FLogger::PrintError(
 			"Unable to create object '", 
-			className, 
+			GetClassNameByID(classID), 
 			"' ", 
 			GUID.A, 
 			"-", 
@@ -634,11 +1476,13 @@ FObjectPtr FEngine::CreateObjectByClassName(const FGuid& GUID, const char* class
 		return nullptr;
 	}
 
-	FObjectPtr object = creator(this, GUID, role);
+	FObjectPtr object = _classCreators[classID](this, GUID, role);
 
 	if (object)
 	{
-		_objects.push_back(object);
+		object->_classID = classID;
+		object->_bDormant = object->IsInitiallyDormant();
+		_objects.Insert(object, object->_handle);
 	}
 
 	return object;
@@ -649,16 +1493,11 @@ FObjectPtr FEngine::RemoveObjectByGUID(const FGuid& GUID)
 	if (!CheckInitialized(__FUNCTION__))
 		return nullptr;
 
-	FObjectPtr object;
-	auto i = std::remove_if(_objects.begin(), _objects.end(), [&](FObjectPtr& item) {
-		if (item->GetGUID() == GUID)
-		{
-			object = item;
-			return true;
-		}
-		return false;
-	});
-	_objects.erase(i, _objects.end());
+	FObjectPtr object = _objects.Remove(GUID);
+	if (object)
+	{
+		_spatialGrid.Remove(object->GetHandle());
+	}
 	return object;
 }
 
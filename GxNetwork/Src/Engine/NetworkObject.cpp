@@ -2,6 +2,8 @@
 #include "../../Include/Engine/NetworkEngine.h"
 #include "../../Include/Common/NetworkLog.h"
 
+#include <algorithm>
+
 namespace gx {
 namespace network {
 	
@@ -38,6 +40,69 @@ uint16_t FObject::GetNetworkRole() const
 	return _role;
 }
 
+uint16_t FObject::GetClassID() const
+{
+	return _classID;
+}
+
+const FObjectHandle& FObject::GetHandle() const
+{
+	return _handle;
+}
+
+bool FObject::IsAlwaysRelevant() const
+{
+	return false;
+}
+
+float FObject::GetReplicationPriority() const
+{
+	return 1.0f;
+}
+
+float FObject::GetClassReplicationFrequency() const
+{
+	return 0.0f;
+}
+
+void FObject::SetReplicationFrequency(float frequency)
+{
+	_replicationFrequency = frequency;
+}
+
+float FObject::GetReplicationFrequency() const
+{
+	return _replicationFrequency < 0.0f ? GetClassReplicationFrequency() : _replicationFrequency;
+}
+
+bool FObject::IsInitiallyDormant() const
+{
+	return false;
+}
+
+void FObject::OnReplicated()
+{
+
+}
+
+void FObject::SetDormant(bool bDormant)
+{
+	_bDormant = bDormant;
+}
+
+bool FObject::IsDormant() const
+{
+	return _bDormant;
+}
+
+void FObject::FlushDormancy()
+{
+	for (FProperty* property : _propertySlots)
+	{
+		MarkPropertyDirty(property->GetIndex());
+	}
+}
+
 FFunction* FObject::GetFunction(const char* name)
 {
 	for (const auto& item : _functions)
@@ -58,6 +123,16 @@ FProperty* FObject::GetProperty(const char* name)
 	return nullptr;
 }
 
+uint32_t FObject::GetPropertyCount() const
+{
+	return GX_NETWORK_SIZE_T_TO_UINT_32_T(_propertySlots.size());
+}
+
+FProperty* FObject::GetPropertyByIndex(uint32_t index) const
+{
+	return index < _propertySlots.size() ? _propertySlots[index] : nullptr;
+}
+
 bool FObject::RegisterFunction(const char* name, FFunction* function)
 {
 	if (GetFunction(name))
@@ -70,11 +145,65 @@ bool FObject::RegisterProperty(const char* name, FProperty* property)
 {
 	if (GetProperty(name))
 		return false;
+	// Property slot index is sent as uint8_t property ID.
+	GX_NETWORK_ASSERT(_propertySlots.size() < FClassSchemaMapping::InvalidPropertyID);
 	_properties[name] = property;
+	property->_index = GX_NETWORK_SIZE_T_TO_UINT_32_T(_propertySlots.size());
+	_propertySlots.push_back(property);
+	// New property has never been serialized.
+	_dirtyProperties.push_back(true);
+	++_dirtyPropertiesCount;
+	_unsentProperties.push_back(true);
+	++_unsentPropertiesCount;
 	return true;
 }
 
+void FObject::MarkPropertyDirty(uint32_t index)
+{
+	GX_NETWORK_ASSERT(index < _dirtyProperties.size());
+	if (!_dirtyProperties[index])
+	{
+		_dirtyProperties[index] = true;
+		++_dirtyPropertiesCount;
+	}
+	if (!_unsentProperties[index])
+	{
+		_unsentProperties[index] = true;
+		++_unsentPropertiesCount;
+	}
+}
+
+bool FObject::IsPropertyDirty(uint32_t index) const
+{
+	GX_NETWORK_ASSERT(index < _dirtyProperties.size());
+	return _dirtyProperties[index];
+}
+
+bool FObject::IsDirty() const
+{
+	return _dirtyPropertiesCount != 0;
+}
+
+void FObject::ClearDirtyProperties()
+{
+	if (_dirtyPropertiesCount != 0)
+	{
+		std::fill(_dirtyProperties.begin(), _dirtyProperties.end(), false);
+		_dirtyPropertiesCount = 0;
+	}
+	if (_unsentPropertiesCount != 0)
+	{
+		std::fill(_unsentProperties.begin(), _unsentProperties.end(), false);
+		_unsentPropertiesCount = 0;
+	}
+}
+
 bool FObject::ExecFunction(const char* name, const FBuffer& parameters)
+{
+	return ExecFunction(name, FBufferView(parameters));
+}
+
+bool FObject::ExecFunction(const char* name, const FBufferView& parameters)
 {
 	FFunction* function = GetFunction(name);
 	if (!function)
@@ -92,38 +221,44 @@ void FObject::ExecFunctionRemote(const char* name, const FBuffer& parameters)
 
 void FObject::operator<<(FIStream& stream)
 {
-	uint32_t propertiesDataSize = 0;
-	stream >> propertiesDataSize;
+	Replicate(stream, nullptr);
+}
+
+void FObject::Replicate(FIStream& stream, const FClassSchemaMapping* classSchemaMapping)
+{
+	uint32_t propertiesDataSize = stream.ReadVarUInt();
 	uint32_t propertiesStartPos = stream.Pos();
 	uint32_t bytesRead = 0;
 	while (bytesRead < propertiesDataSize)
 	{
 		uint32_t bytesReadOffset = stream.Pos();
-		std::string propertyName;
-		stream >> propertyName;
-		FProperty::EType type;
-		stream >> type;
-		bool isVectorProperty = type == FProperty::EType::Vector;
-		FProperty::EType elementType;
-		if (isVectorProperty)
+		uint8_t propertyID = 0;
+		stream >> propertyID;
+		uint32_t propertyDataSize = stream.ReadVarUInt();
+		uint32_t propertyStartPos = stream.Pos();
+		bool bChunks = propertyID == ChunksPropertyID;
+		if (bChunks)
 		{
-			stream >> elementType;
+			stream >> propertyID;
 		}
-		uint32_t propertyDataSize = 0;
-		stream >> propertyDataSize;
-		uint32_t propertyStartPos = stream.Pos();
-		FProperty* property = GetProperty(propertyName.c_str());
-		if  (property && property->GetType() == type && 
-			(isVectorProperty ? static_cast<FVectorProperty*>(property)->GetElementType() == elementType : true))
+		uint32_t propertyIndex = propertyID;
+		if (classSchemaMapping)
+		{
+			propertyIndex = propertyID < classSchemaMapping->Properties.size() ? 
+				classSchemaMapping->Properties[propertyID] : 
+				FClassSchemaMapping::InvalidPropertyID;
+		}
+		FProperty* property = GetPropertyByIndex(propertyIndex);
+		if (property && !bChunks)
 		{
 			property->operator<<(stream);
 		}
-		else
+		else if (!property || !property->ReplicateChunks(stream))
 		{
 			FLogger::PrintWarning(
-				"Unable to replicate property '",
-				propertyName,
-				"' at <",
+				"Unable to replicate property #",
+				static_cast<uint32_t>(propertyID),
+				" at <",
 				GetClassName(),
 				"> [",
 				_GUID.A,
@@ -141,31 +276,155 @@ void FObject::operator<<(FIStream& stream)
 	}
 	stream.SetPos(propertiesStartPos);
 	stream.Read(propertiesDataSize);
+	OnReplicated();
 }
 
+// Properties semantic
+//
+// 1. Properties data size		| varuint
+// 2. Properties				| Property[]
+//
+// Property semantic
+//
+// 1. Property ID				| uint8_t (ChunksPropertyID - chunks of property revision data follow)
+// 2. Property data size		| varuint
+// 3. Chunked property ID		| uint8_t (chunks only)
+// 4. Property data				| uint8_t[] (see FProperty::ReplicateChunks() for chunks)
+
 void FObject::operator>>(FOStream& stream) const
 {
-	uint32_t propertiesStartPos = stream.Pos();
-	for (const auto& item : _properties)
+	uint32_t propertiesSizePos = stream.ReserveSize(GetSizeHint(false));
+	for (FProperty* property : _propertySlots)
 	{
-		stream << item.first;
-		FProperty::EType type = item.second->GetType();
-		stream << type;
-		if (type == FProperty::EType::Vector)
+		SerializeProperty(stream, property);
+	}
+	stream.CommitSize(propertiesSizePos);
+}
+
+void FObject::ReplicateDirty(FOStream& stream)
+{
+	uint32_t propertiesSizePos = stream.ReserveSize(GetSizeHint(true));
+	for (FProperty* property : _propertySlots)
+	{
+		if (_unsentProperties[property->GetIndex()])
 		{
-			stream << static_cast<FVectorProperty*>(item.second)->GetElementType();
+			SerializeProperty(stream, property);
 		}
-		uint32_t propertyStartPos = stream.Pos();
-		item.second->operator>>(stream);
-		uint32_t propertyDataSize = stream.Pos() - propertyStartPos;
-		stream.SetPos(propertyStartPos);
-		stream << propertyDataSize;
-		stream.SetPos(propertyStartPos + propertyDataSize + sizeof(propertyDataSize));
 	}
-	uint32_t propertiesDataSize = stream.Pos() - propertiesStartPos;
-	stream.SetPos(propertiesStartPos);
-	stream << propertiesDataSize;
-	stream.SetPos(propertiesStartPos + propertiesDataSize + sizeof(propertiesDataSize));
+	stream.CommitSize(propertiesSizePos);
+	if (_unsentPropertiesCount != 0)
+	{
+		std::fill(_unsentProperties.begin(), _unsentProperties.end(), false);
+		_unsentPropertiesCount = 0;
+	}
+}
+
+void FObject::SerializeProperty(FOStream& stream, const FProperty* property) const
+{
+	stream << static_cast<uint8_t>(property->GetIndex());
+	uint32_t propertySizePos = stream.ReserveSize(property->_sizeHint);
+	property->operator>>(stream);
+	property->_sizeHint = stream.CommitSize(propertySizePos);
+}
+
+uint32_t FObject::GetSizeHint(bool bUnsentOnly) const
+{
+	// Whole property data size is taken from its previous serialization.
+	uint32_t sizeHint = 0;
+	for (FProperty* property : _propertySlots)
+	{
+		if (!bUnsentOnly || _unsentProperties[property->GetIndex()])
+		{
+			sizeHint += sizeof(uint8_t) + FOStream::MaxVarUIntSize + property->_sizeHint;
+		}
+	}
+	return sizeHint;
+}
+
+uint32_t FObject::GetDeltaSizeHint(uint32_t baselineFrameIndex, bool bChunks) const
+{
+	uint32_t sizeHint = 0;
+	for (FProperty* property : _propertySlots)
+	{
+		if (bChunks && property->IsChunked())
+		{
+			sizeHint += 2 * sizeof(uint8_t) + FOStream::MaxVarUIntSize + GetChunksSizeHint(property);
+		}
+		else if (property->GetRevision() > baselineFrameIndex)
+		{
+			sizeHint += sizeof(uint8_t) + FOStream::MaxVarUIntSize + GX_NETWORK_SIZE_T_TO_UINT_32_T(property->GetRevisionData().size());
+		}
+	}
+	return sizeHint;
+}
+
+uint32_t FObject::GetChunksSizeHint(const FProperty* property)
+{
+	// All chunks with their indices, revision data size, completion flag and chunks count (see FProperty::ReplicateChunks()).
+	uint32_t chunksCount = GX_NETWORK_SIZE_T_TO_UINT_32_T(property->GetChunkRevisions().size());
+	return GX_NETWORK_SIZE_T_TO_UINT_32_T(property->GetRevisionData().size()) + (chunksCount + 2) * FOStream::MaxVarUIntSize + sizeof(uint8_t);
+}
+
+void FObject::ReplicateDelta(FOStream& stream, uint32_t baselineFrameIndex, FPropertyChunkWriter* chunkWriter) const
+{
+	uint32_t propertiesSizePos = stream.ReserveSize(GetDeltaSizeHint(baselineFrameIndex, chunkWriter != nullptr));
+	for (FProperty* property : _propertySlots)
+	{
+		// Chunks are tracked by writer per remote engine, baseline is not used.
+		if (chunkWriter && property->IsChunked())
+		{
+			uint32_t propertyStartPos = stream.Pos();
+			stream << static_cast<uint8_t>(ChunksPropertyID);
+			uint32_t propertySizePos = stream.ReserveSize(sizeof(uint8_t) + GetChunksSizeHint(property));
+			stream << static_cast<uint8_t>(property->GetIndex());
+			if (chunkWriter->WriteChunks(stream, *property))
+			{
+				stream.CommitSize(propertySizePos);
+			}
+			else
+			{
+				stream.Truncate(propertyStartPos);
+			}
+			continue;
+		}
+		if (property->GetRevision() <= baselineFrameIndex)
+			continue;
+		stream << static_cast<uint8_t>(property->GetIndex());
+		const std::vector<uint8_t>& propertyData = property->GetRevisionData();
+		uint32_t propertyDataSize = GX_NETWORK_SIZE_T_TO_UINT_32_T(propertyData.size());
+		stream.WriteVarUInt(propertyDataSize);
+		stream.Write(propertyData.data(), propertyDataSize);
+	}
+	stream.CommitSize(propertiesSizePos);
+}
+
+bool FObject::UpdateRevision(uint32_t frameIndex, FBuffer& scratch)
+{
+	bool bChanged = false;
+	if (_dirtyPropertiesCount != 0)
+	{
+		for (FProperty* property : _propertySlots)
+		{
+			if (_dirtyProperties[property->GetIndex()])
+			{
+				bChanged = property->UpdateRevision(frameIndex, scratch) || bChanged;
+			}
+		}
+		// Dirty bits of ReplicateDirty() are kept.
+		std::fill(_dirtyProperties.begin(), _dirtyProperties.end(), false);
+		_dirtyPropertiesCount = 0;
+	}
+	// Object without replicated state yet should appear in the next frame anyway.
+	if (bChanged || _revision == 0)
+	{
+		_revision = frameIndex;
+	}
+	return bChanged;
+}
+
+uint32_t FObject::GetRevision() const
+{
+	return _revision;
 }
 
 }
@@ -0,0 +1,183 @@
+#include "../../Include/Engine/NetworkObjectTable.h"
+#include "../../Include/Engine/NetworkObject.h"
+
+namespace gx {
+namespace network {
+
+FObjectTable::FObjectTable()
+{
+}
+
+FObjectTable::~FObjectTable()
+{
+}
+
+FObjectPtr FObjectTable::Find(const FGuid& GUID) const
+{
+	if (_slots.empty())
+		return nullptr;
+	uint32_t slot = FindSlot(GUID);
+	return _slots[slot] != EmptySlot ? _objects[_slots[slot]] : nullptr;
+}
+
+FObjectPtr FObjectTable::Find(const FObjectHandle& handle) const
+{
+	uint32_t index = handle.GetIndex();
+	if (!handle.IsValid() || index >= _handleSlots.size())
+		return nullptr;
+	const FHandleSlot& handleSlot = _handleSlots[index];
+	if (handleSlot.Generation != handle.GetGeneration() || handleSlot.Position == EmptySlot)
+		return nullptr;
+	return _objects[handleSlot.Position];
+}
+
+bool FObjectTable::Insert(const FObjectPtr& object, FObjectHandle& handle)
+{
+	// Keep load factor below 0.5, probe sequences stay short.
+	if ((_objects.size() + 1) * 2 > _slots.size())
+	{
+		Rehash(_slots.empty() ? 64 : GX_NETWORK_SIZE_T_TO_UINT_32_T(_slots.size() * 2));
+	}
+	uint32_t slot = FindSlot(object->GetGUID());
+	if (_slots[slot] != EmptySlot)
+		return false;
+
+	uint32_t handleIndex = 0;
+	if (!_freeHandleSlots.empty())
+	{
+		handleIndex = _freeHandleSlots.back();
+		_freeHandleSlots.pop_back();
+	}
+	else
+	{
+		GX_NETWORK_ASSERT(_handleSlots.size() <= FObjectHandle::IndexMask);
+		handleIndex = GX_NETWORK_SIZE_T_TO_UINT_32_T(_handleSlots.size());
+		_handleSlots.push_back({ 1, EmptySlot });
+	}
+
+	uint32_t position = GX_NETWORK_SIZE_T_TO_UINT_32_T(_objects.size());
+	_handleSlots[handleIndex].Position = position;
+	handle = FObjectHandle(handleIndex, _handleSlots[handleIndex].Generation);
+
+	_slots[slot] = position;
+	_keys.push_back(object->GetGUID());
+	_handles.push_back(handle);
+	_objects.push_back(object);
+	return true;
+}
+
+FObjectPtr FObjectTable::Remove(const FGuid& GUID)
+{
+	if (_slots.empty())
+		return nullptr;
+
+	uint32_t slot = FindSlot(GUID);
+	if (_slots[slot] == EmptySlot)
+		return nullptr;
+
+	uint32_t index = _slots[slot];
+	FObjectPtr object = _objects[index];
+
+	// Backward shift deletion: move following entries of the probe sequence into the hole.
+	uint32_t mask = GX_NETWORK_SIZE_T_TO_UINT_32_T(_slots.size() - 1);
+	uint32_t hole = slot;
+	uint32_t i = slot;
+	for (;;)
+	{
+		i = (i + 1) & mask;
+		if (_slots[i] == EmptySlot)
+			break;
+		uint32_t home = Hash(_keys[_slots[i]]) & mask;
+		bool bMove = i > hole ? (home <= hole || home > i) : (home <= hole && home > i);
+		if (bMove)
+		{
+			_slots[hole] = _slots[i];
+			hole = i;
+		}
+	}
+	_slots[hole] = EmptySlot;
+
+	// Next generation makes handles of the removed object stale.
+	FHandleSlot& handleSlot = _handleSlots[_handles[index].GetIndex()];
+	handleSlot.Generation = handleSlot.Generation == FObjectHandle::GenerationMask ? 1 : handleSlot.Generation + 1;
+	handleSlot.Position = EmptySlot;
+	_freeHandleSlots.push_back(_handles[index].GetIndex());
+
+	// Fill the gap in dense array with the last object.
+	uint32_t last = GX_NETWORK_SIZE_T_TO_UINT_32_T(_objects.size() - 1);
+	if (index != last)
+	{
+		_slots[FindSlot(_keys[last])] = index;
+		_handleSlots[_handles[last].GetIndex()].Position = index;
+		_keys[index] = _keys[last];
+		_handles[index] = _handles[last];
+		_objects[index] = std::move(_objects[last]);
+	}
+	_keys.pop_back();
+	_handles.pop_back();
+	_objects.pop_back();
+
+	return object;
+}
+
+void FObjectTable::Clear()
+{
+	_slots.clear();
+	_keys.clear();
+	_handles.clear();
+	_objects.clear();
+	_handleSlots.clear();
+	_freeHandleSlots.clear();
+}
+
+uint32_t FObjectTable::Size() const
+{
+	return GX_NETWORK_SIZE_T_TO_UINT_32_T(_objects.size());
+}
+
+std::vector<FObjectPtr>::const_iterator FObjectTable::begin() const
+{
+	return _objects.begin();
+}
+
+std::vector<FObjectPtr>::const_iterator FObjectTable::end() const
+{
+	return _objects.end();
+}
+
+uint32_t FObjectTable::Hash(const FGuid& GUID)
+{
+	uint32_t hash = GUID.A * 0x9E3779B1u;
+	hash ^= GUID.B + 0x7F4A7C15u + (hash << 6) + (hash >> 2);
+	hash ^= GUID.C + 0x7F4A7C15u + (hash << 6) + (hash >> 2);
+	hash ^= GUID.D + 0x7F4A7C15u + (hash << 6) + (hash >> 2);
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	return hash;
+}
+
+uint32_t FObjectTable::FindSlot(const FGuid& GUID) const
+{
+	GX_NETWORK_ASSERT(!_slots.empty());
+	uint32_t mask = GX_NETWORK_SIZE_T_TO_UINT_32_T(_slots.size() - 1);
+	uint32_t slot = Hash(GUID) & mask;
+	while (_slots[slot] != EmptySlot && _keys[_slots[slot]] != GUID)
+	{
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+void FObjectTable::Rehash(uint32_t capacity)
+{
+	GX_NETWORK_ASSERT((capacity & (capacity - 1)) == 0);
+	_slots.assign(capacity, EmptySlot);
+	for (uint32_t index = 0; index < _keys.size(); ++index)
+	{
+		_slots[FindSlot(_keys[index])] = index;
+	}
+}
+
+}
+}
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "../../Include/Engine/NetworkProperty.h"
 #include "../../Include/Engine/NetworkObject.h"
 
+#include <cstring>
+
 namespace gx {
 namespace network {
 
 FProperty::FProperty(FObject* object, const char* name, FProperty::EType type)
-	: _type(type)
+	: _object(object)
+	, _name(name)
+	, _type(type)
 {
 	object->RegisterProperty(name, this);
 }
@@ -15,11 +19,127 @@ FProperty::~FProperty()
 
 }
 
+const char* FProperty::GetName() const
+{
+	return _name;
+}
+
 FProperty::EType FProperty::GetType() const
 {
 	return _type;
 }
 
+uint32_t FProperty::GetIndex() const
+{
+	return _index;
+}
+
+void FProperty::MarkDirty()
+{
+	_object->MarkPropertyDirty(_index);
+}
+
+uint32_t FProperty::GetRevision() const
+{
+	return _revision;
+}
+
+const std::vector<uint8_t>& FProperty::GetRevisionData() const
+{
+	return _revisionData;
+}
+
+bool FProperty::UpdateRevision(uint32_t frameIndex, FBuffer& scratch)
+{
+	scratch.Clear();
+	FOStream stream(scratch);
+	operator>>(stream);
+	if (scratch.Size() == _revisionData.size() && memcmp(scratch.Data(), _revisionData.data(), scratch.Size()) == 0)
+	{
+		return false;
+	}
+
+	// Chunks are compared with the previous revision data, so only changed chunks are sent again.
+	uint32_t size = scratch.Size();
+	uint32_t previousSize = GX_NETWORK_SIZE_T_TO_UINT_32_T(_revisionData.size());
+	uint32_t chunksCount = (size + ChunkSize - 1) / ChunkSize;
+	uint32_t previousChunksCount = GX_NETWORK_SIZE_T_TO_UINT_32_T(_chunkRevisions.size());
+	for (uint32_t chunk = 0; chunk < chunksCount && chunk < previousChunksCount; ++chunk)
+	{
+		uint32_t chunkPos = chunk * ChunkSize;
+		uint32_t chunkSize = size - chunkPos < ChunkSize ? size - chunkPos : ChunkSize;
+		uint32_t previousChunkSize = previousSize - chunkPos < ChunkSize ? previousSize - chunkPos : ChunkSize;
+		if (chunkSize != previousChunkSize || memcmp(scratch.Data() + chunkPos, _revisionData.data() + chunkPos, chunkSize) != 0)
+		{
+			_chunkRevisions[chunk] = frameIndex;
+		}
+	}
+	_chunkRevisions.resize(chunksCount, frameIndex);
+
+	_revisionData.assign(scratch.Data(), scratch.Data() + scratch.Size());
+	_revision = frameIndex;
+	return true;
+}
+
+bool FProperty::IsChunked() const
+{
+	return _revisionData.size() > ChunkSize;
+}
+
+const std::vector<uint32_t>& FProperty::GetChunkRevisions() const
+{
+	return _chunkRevisions;
+}
+
+// Chunks semantic
+//
+// 1. Revision data size		| varuint
+// 2. Last chunks of transfer	| bool (collected revision data is complete)
+// 3. Chunks count				| varuint
+// 4. Chunks					| Chunk[]
+//
+// Chunk semantic
+//
+// 1. Chunk index				| varuint
+// 2. Chunk data				| uint8_t[] (ChunkSize, the last chunk - the rest of revision data)
+
+bool FProperty::ReplicateChunks(FIStream& stream)
+{
+	uint32_t size = stream.ReadVarUInt();
+	bool bComplete = false;
+	stream >> bComplete;
+	uint32_t chunksCount = stream.ReadVarUInt();
+	// Size comes from remote side, it is checked before allocation.
+	if (size > MaxChunkedSize)
+		return false;
+
+	// Data of unchanged chunks is kept from the previous transfers.
+	_chunksData.resize(size);
+	for (uint32_t i = 0; i < chunksCount; ++i)
+	{
+		uint32_t chunk = stream.ReadVarUInt();
+		if (chunk >= (size + ChunkSize - 1) / ChunkSize)
+			return false;
+		uint32_t chunkPos = chunk * ChunkSize;
+		uint32_t chunkSize = size - chunkPos < ChunkSize ? size - chunkPos : ChunkSize;
+		if (chunkSize > stream.Remaining())
+			return false;
+		memcpy(_chunksData.data() + chunkPos, stream.Read(chunkSize), chunkSize);
+	}
+
+	if (bComplete)
+	{
+		FIStream chunksStream(FBufferView(_chunksData.data(), size));
+		operator<<(chunksStream);
+	}
+	return true;
+}
+
+FPropertyChunkWriter::~FPropertyChunkWriter()
+{
+
+}
+
 FVectorProperty::FVectorProperty(FObject* object, const char* name, EType elementType)
 	: FProperty(object, name, EType::Vector)
 	, _elementType(elementType)
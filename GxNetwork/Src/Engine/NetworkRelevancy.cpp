@@ -0,0 +1,27 @@
+#include "../../Include/Engine/NetworkRelevancy.h"
+
+namespace gx {
+namespace network {
+
+FRelevancyPolicy::~FRelevancyPolicy()
+{
+
+}
+
+void FRelevancyPolicy::BeginFrame(const FEngine& engine, const FRemoteEnginePtr& remoteEngine)
+{
+
+}
+
+bool FRelevancyPolicy::GatherCandidates(const FEngine& engine, const FRemoteEnginePtr& remoteEngine, std::vector<FObjectHandle>& handles)
+{
+	return false;
+}
+
+float FRelevancyPolicy::GetPriorityScale(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine)
+{
+	return 1.0f;
+}
+
+}
+}
@@ -0,0 +1,178 @@
+#include "../../Include/Engine/NetworkSpatialGrid.h"
+
+#include <cmath>
+
+namespace gx {
+namespace network {
+
+FSpatialGrid::FSpatialGrid(float cellSize)
+	: _cellSize(cellSize)
+	, _inverseCellSize(1.0f / cellSize)
+{
+	GX_NETWORK_ASSERT(cellSize > 0.0f);
+}
+
+FSpatialGrid::~FSpatialGrid()
+{
+
+}
+
+void FSpatialGrid::Update(const FObjectHandle& handle, const FVec3f& location)
+{
+	uint32_t index = handle.GetIndex();
+	if (index >= _entries.size())
+	{
+		_entries.resize(index + 1, { FObjectHandle(), FVec3f(), 0, 0 });
+	}
+
+	FEntry& entry = _entries[index];
+	uint64_t cellKey = GetCellKey(location);
+
+	if (entry.Handle == handle && entry.CellKey == cellKey)
+	{
+		entry.Location = location;
+		return;
+	}
+
+	// Slot may still hold stale handle of removed object, which was not removed from grid.
+	if (entry.Handle.IsValid())
+	{
+		RemoveFromCell(entry);
+	}
+
+	std::vector<uint32_t>& cell = _cells[cellKey];
+	entry.Handle = handle;
+	entry.Location = location;
+	entry.CellKey = cellKey;
+	entry.CellPosition = GX_NETWORK_SIZE_T_TO_UINT_32_T(cell.size());
+	cell.push_back(index);
+}
+
+void FSpatialGrid::Remove(const FObjectHandle& handle)
+{
+	if (!Contains(handle))
+		return;
+
+	FEntry& entry = _entries[handle.GetIndex()];
+	RemoveFromCell(entry);
+	entry.Handle = FObjectHandle();
+}
+
+void FSpatialGrid::Clear()
+{
+	_entries.clear();
+	_cells.clear();
+}
+
+bool FSpatialGrid::Contains(const FObjectHandle& handle) const
+{
+	uint32_t index = handle.GetIndex();
+	return handle.IsValid() && index < _entries.size() && _entries[index].Handle == handle;
+}
+
+template <class FPredicate>
+void FSpatialGrid::Query(const FVec3f& min, const FVec3f& max, const FPredicate& predicate, std::vector<FObjectHandle>& handles) const
+{
+	int32_t minX = GetCellCoord(min.x), maxX = GetCellCoord(max.x);
+	int32_t minY = GetCellCoord(min.y), maxY = GetCellCoord(max.y);
+	int32_t minZ = GetCellCoord(min.z), maxZ = GetCellCoord(max.z);
+
+	// Volume larger than the occupied cells count is cheaper to check cell by cell.
+	uint64_t cellsCount = static_cast<uint64_t>(maxX - minX + 1) * static_cast<uint64_t>(maxY - minY + 1) * static_cast<uint64_t>(maxZ - minZ + 1);
+	if (cellsCount > _cells.size())
+	{
+		for (const auto& cell : _cells)
+		{
+			for (uint32_t index : cell.second)
+			{
+				const FEntry& entry = _entries[index];
+				if (predicate(entry.Location))
+					handles.push_back(entry.Handle);
+			}
+		}
+		return;
+	}
+
+	for (int32_t z = minZ; z <= maxZ; ++z)
+	{
+		for (int32_t y = minY; y <= maxY; ++y)
+		{
+			for (int32_t x = minX; x <= maxX; ++x)
+			{
+				auto item = _cells.find(MakeCellKey(x, y, z));
+				if (item == _cells.end())
+					continue;
+				for (uint32_t index : item->second)
+				{
+					const FEntry& entry = _entries[index];
+					if (predicate(entry.Location))
+						handles.push_back(entry.Handle);
+				}
+			}
+		}
+	}
+}
+
+void FSpatialGrid::QueryRadius(const FVec3f& center, float radius, std::vector<FObjectHandle>& handles) const
+{
+	FVec3f min(center.x - radius, center.y - radius, center.z - radius);
+	FVec3f max(center.x + radius, center.y + radius, center.z + radius);
+	float radiusSquared = radius * radius;
+	Query(min, max, [&center, radiusSquared](const FVec3f& location) {
+		float dx = location.x - center.x;
+		float dy = location.y - center.y;
+		float dz = location.z - center.z;
+		return dx * dx + dy * dy + dz * dz <= radiusSquared;
+	}, handles);
+}
+
+void FSpatialGrid::QueryBox(const FVec3f& min, const FVec3f& max, std::vector<FObjectHandle>& handles) const
+{
+	Query(min, max, [&min, &max](const FVec3f& location) {
+		return location.x >= min.x && location.x <= max.x &&
+			location.y >= min.y && location.y <= max.y &&
+			location.z >= min.z && location.z <= max.z;
+	}, handles);
+}
+
+float FSpatialGrid::GetCellSize() const
+{
+	return _cellSize;
+}
+
+uint64_t FSpatialGrid::GetCellKey(const FVec3f& location) const
+{
+	return MakeCellKey(GetCellCoord(location.x), GetCellCoord(location.y), GetCellCoord(location.z));
+}
+
+int32_t FSpatialGrid::GetCellCoord(float value) const
+{
+	// Cell coordinates are limited to 21 bits each (see MakeCellKey()).
+	float coord = std::floor(value * _inverseCellSize);
+	coord = coord < -1048576.0f ? -1048576.0f : (coord > 1048575.0f ? 1048575.0f : coord);
+	return static_cast<int32_t>(coord);
+}
+
+uint64_t FSpatialGrid::MakeCellKey(int32_t x, int32_t y, int32_t z)
+{
+	const uint64_t mask = (1ull << 21) - 1;
+	return (static_cast<uint64_t>(x) & mask) | ((static_cast<uint64_t>(y) & mask) << 21) | ((static_cast<uint64_t>(z) & mask) << 42);
+}
+
+void FSpatialGrid::RemoveFromCell(const FEntry& entry)
+{
+	auto item = _cells.find(entry.CellKey);
+	GX_NETWORK_ASSERT(item != _cells.end());
+	std::vector<uint32_t>& cell = item->second;
+	uint32_t last = cell.back();
+	cell[entry.CellPosition] = last;
+	_entries[last].CellPosition = entry.CellPosition;
+	cell.pop_back();
+	if (cell.empty())
+	{
+		_cells.erase(item);
+	}
+}
+
+}
+}
@@ -2,10 +2,18 @@
 #include "../../Include/Common/NetworkLog.h"
 
 #include <algorithm>
+#include <memory>
 
 namespace gx {
 namespace network {
 
+FManager::FManager()
+	: _remoteEnginesSnapshot(new std::vector<FRemoteEnginePtr>())
+	, _compressionThreshold(DefaultCompressionThreshold)
+{
+	RegisterCodec(FCodecPtr(new FLZCodec()));
+}
+
 FManager::~FManager()
 {
 	
@@ -87,6 +95,7 @@ bool FManager::ProcessResponse(const FGuid& remoteEngineGUID, const FBuffer& inp
 				{
 					FCommand<ECommand::EventsFrameRecieve> command;
 					istream >> command;
+					result = result && DecompressFrame(remoteEngine, command);
 					result = result && ProcessResponseEventsFrameRecieve(remoteEngine, command, ostream);
 					break;
 				}
@@ -103,6 +112,7 @@ bool FManager::ProcessResponse(const FGuid& remoteEngineGUID, const FBuffer& inp
 				{
 					FCommand<ECommand::ReplicationFrameRecieve> command;
 					istream >> command;
+					result = result && DecompressFrame(remoteEngine, command);
 					result = result && ProcessResponseReplicationFrameRecieve(remoteEngine, command, ostream);
 					break;
 				}
@@ -137,22 +147,167 @@ void FManager::RemoteEngineDisconnected(const FGuid& remoteEngineGUID)
 	}
 }
 
-FRemoteEnginePtr FManager::FindRemoteEngine(const FGuid & remoteEngineGUID)
+void FManager::SetClassSchema(const std::vector<FClassSchema>& classes)
 {
+	FEvent<EEvent::ClassSchema> classSchemaEvent;
+	classSchemaEvent.Classes = classes;
+	FConstBufferPtr classSchemaEventData = FRemoteEngine::SerializeEvent(classSchemaEvent);
 	std::vector<FRemoteEnginePtr>& remoteEngines = LockRemoteEngines();
-	auto item = std::find_if(remoteEngines.begin(), remoteEngines.end(), [remoteEngineGUID](FRemoteEnginePtr& remoteEngine) {
+	_classSchemaEventData = classSchemaEventData;
+	for (FRemoteEnginePtr& remoteEngine : remoteEngines)
+		remoteEngine->PushEventData(_classSchemaEventData);
+	UnLockRemoteEngines();
+}
+
+std::vector<FRemoteEnginePtr> FManager::GetRemoteEngines()
+{
+	return *GetRemoteEnginesSnapshot();
+}
+
+FRemoteEnginePtr FManager::FindRemoteEngine(const FGuid & remoteEngineGUID)
+{
+	FRemoteEnginesSnapshot remoteEngines = GetRemoteEnginesSnapshot();
+	auto item = std::find_if(remoteEngines->begin(), remoteEngines->end(), [remoteEngineGUID](const FRemoteEnginePtr& remoteEngine) {
 		return remoteEngine->GetGUID() == remoteEngineGUID;
 	});
-	FRemoteEnginePtr remoteEngine = item != remoteEngines.end() ? *item : nullptr;
-	UnLockRemoteEngines();
-	return remoteEngine;
+	return item != remoteEngines->end() ? *item : nullptr;
+}
+
+void FManager::RegisterCodec(const FCodecPtr& codec)
+{
+	auto i = std::remove_if(_codecs.begin(), _codecs.end(), [&](const FCodecPtr& item) {
+		return item->GetType() == codec->GetType();
+	});
+	_codecs.erase(i, _codecs.end());
+	_codecs.insert(_codecs.begin(), codec);
+}
+
+void FManager::SetCompressionDictionary(const FBufferView& dictionary)
+{
+	RegisterCodec(FCodecPtr(new FLZCodec(dictionary)));
+}
+
+uint32_t FManager::GetAcceptedCodecs() const
+{
+	uint32_t codecs = 0;
+	for (const FCodecPtr& codec : _codecs)
+		codecs |= 1u << static_cast<uint32_t>(codec->GetType());
+	return codecs;
+}
+
+void FManager::SetCompressionThreshold(uint32_t threshold)
+{
+	_compressionThreshold = threshold;
+}
+
+void FManager::CompressFrame(const FRemoteEnginePtr& remoteEngine, FFrameCommand& command) const
+{
+	if (command.Codec != ECodec::None || command.FrameSize < _compressionThreshold)
+		return;
+
+	uint32_t acceptedCodecs = remoteEngine->GetAcceptedCodecs();
+	for (const FCodecPtr& codec : _codecs)
+	{
+		if ((acceptedCodecs & (1u << static_cast<uint32_t>(codec->GetType()))) == 0)
+			continue;
+
+		FBufferView frame(command.FrameData, command.FrameSize);
+		if (codec->Compress(frame, command.FrameStorage) && command.FrameStorage.Size() < command.FrameSize)
+		{
+			command.Codec = codec->GetType();
+			command.UncompressedSize = command.FrameSize;
+			command.FrameSize = command.FrameStorage.Size();
+			command.FrameData = command.FrameStorage.Data();
+		}
+		return;
+	}
+}
+
+void FManager::WriteEventsFrame(const FRemoteEnginePtr& remoteEngine, FOStream& stream) const
+{
+	const FBuffer& frame = remoteEngine->GetEventsFrame();
+	frame.Lock();
+	FCommand<ECommand::EventsFrameRecieve> command;
+	command.FrameSize = frame.Size();
+	command.FrameData = frame.Data();
+	CompressFrame(remoteEngine, command);
+	stream << ECommand::EventsFrameRecieve;
+	stream << command;
+	frame.UnLock();
+}
+
+void FManager::WriteReplicationFrame(const FRemoteEnginePtr& remoteEngine, const FBuffer& frame, FOStream& stream) const
+{
+	frame.Lock();
+	FCommand<ECommand::ReplicationFrameRecieve> command;
+	command.FrameSize = frame.Size();
+	command.FrameData = frame.Data();
+	CompressFrame(remoteEngine, command);
+	stream << ECommand::ReplicationFrameRecieve;
+	stream << command;
+	frame.UnLock();
+}
+
+bool FManager::DecompressFrame(const FRemoteEnginePtr& remoteEngine, FFrameCommand& command) const
+{
+	if (command.Codec == ECodec::None)
+		return true;
+
+	const FCodecPtr* codec = FindCodec(command.Codec);
+	FBufferView frame(command.FrameData, command.FrameSize);
+	if (!codec || !(*codec)->Decompress(frame, command.UncompressedSize, command.FrameStorage))
+	{
+		const FGuid& GUID = remoteEngine->GetGUID();
+		FLogger::PrintError("Unable to decompress frame with codec #",
+			static_cast<uint32_t>(command.Codec),
+			" from engine [",
+			GUID.A,
+			"-",
+			GUID.B,
+			"-",
+			GUID.C,
+			"-",
+			GUID.D,
+			"].");
+		return false;
+	}
+
+	command.Codec = ECodec::None;
+	command.FrameSize = command.FrameStorage.Size();
+	command.FrameData = command.FrameStorage.Data();
+	return true;
+}
+
+const FCodecPtr* FManager::FindCodec(ECodec codec) const
+{
+	auto item = std::find_if(_codecs.begin(), _codecs.end(), [codec](const FCodecPtr& item) {
+		return item->GetType() == codec;
+	});
+	return item != _codecs.end() ? &*item : nullptr;
+}
+
+FManager::FRemoteEnginesSnapshot FManager::GetRemoteEnginesSnapshot() const
+{
+	return std::atomic_load(&_remoteEnginesSnapshot);
+}
+
+void FManager::UpdateRemoteEnginesSnapshot()
+{
+	// Called under _remoteEnginesLock.
+	std::atomic_store(&_remoteEnginesSnapshot, FRemoteEnginesSnapshot(new std::vector<FRemoteEnginePtr>(_remoteEngines)));
 }
 
 FRemoteEnginePtr FManager::CreateRemoteEngine(const FGuid& remoteEngineGUID)
 {
 	std::vector<FRemoteEnginePtr>& remoteEngines = LockRemoteEngines();
 	FRemoteEnginePtr remoteEngine = FRemoteEnginePtr(new FRemoteEngine(remoteEngineGUID));
+	// Class schema should precede any event referencing local property IDs.
+	if (_classSchemaEventData)
+	{
+		remoteEngine->PushEventData(_classSchemaEventData);
+	}
 	remoteEngines.push_back(remoteEngine);
+	UpdateRemoteEnginesSnapshot();
 	UnLockRemoteEngines();
 	return remoteEngine;
 }
@@ -170,6 +325,7 @@ FRemoteEnginePtr FManager::RemoveRemoteEngine(const FGuid& remoteEngineGUID)
 		return false;
 	});
 	remoteEngines.erase(i, remoteEngines.end());
+	UpdateRemoteEnginesSnapshot();
 	UnLockRemoteEngines();
 	return remoteEngine;
 }
@@ -186,6 +342,7 @@ bool FManager::ProcessResponsePong(const FRemoteEnginePtr& remote, const FComman
 
 bool FManager::ProcessResponseEventsFrameRequest(const FRemoteEnginePtr& remote, const FCommand<ECommand::EventsFrameRequest>& inCommand, FOStream& stream)
 {
+	remote->SetAcceptedCodecs(inCommand.AcceptedCodecs);
 	return OnProcessResponseEventsFrameRequest(remote, inCommand, stream);
 }
 
@@ -196,6 +353,8 @@ bool FManager::ProcessResponseEventsFrameRecieve(const FRemoteEnginePtr& remote,
 
 bool FManager::ProcessResponseReplicationFrameRequest(const FRemoteEnginePtr& remote, const FCommand<ECommand::ReplicationFrameRequest>& inCommand, FOStream& stream)
 {
+	remote->SetAcknowledgedReplicationFrameIndex(inCommand.AcknowledgedFrameIndex);
+	remote->SetAcceptedCodecs(inCommand.AcceptedCodecs);
 	return OnProcessResponseReplicationFrameRequest(remote, inCommand, stream);
 }
 
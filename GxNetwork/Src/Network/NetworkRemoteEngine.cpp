@@ -5,6 +5,9 @@ namespace network {
 
 FRemoteEngine::FRemoteEngine(const FGuid& GUID)
 	: _GUID(GUID)
+	, _acknowledgedReplicationFrameIndex(0)
+	, _recievedReplicationFrameIndex(0)
+	, _acceptedCodecs(0)
 {
 }
 
@@ -19,8 +22,153 @@ const FGuid& FRemoteEngine::GetGUID() const
 
 FBuffer& FRemoteEngine::GetEventsFrame()
 {
+	FConstBufferPtr event;
+	_eventsFrame.Lock();
+	while (_pendingEvents.Pop(event))
+	{
+		_eventsFrame.Append(event->Data(), event->Size());
+	}
+	_eventsFrame.UnLock();
 	return _eventsFrame;
 }
 
+void FRemoteEngine::PushEventData(const FConstBufferPtr& eventData)
+{
+	_pendingEvents.Push(eventData);
+}
+
+FBuffer& FRemoteEngine::GetReplicationFrame()
+{
+	return _replicationFrame;
+}
+
+uint32_t FRemoteEngine::GetAcknowledgedReplicationFrameIndex() const
+{
+	return _acknowledgedReplicationFrameIndex;
+}
+
+void FRemoteEngine::SetAcknowledgedReplicationFrameIndex(uint32_t frameIndex)
+{
+	// Acknowledges may come out of order, keep the newest one.
+	uint32_t current = _acknowledgedReplicationFrameIndex;
+	while (current < frameIndex && !_acknowledgedReplicationFrameIndex.compare_exchange_weak(current, frameIndex))
+	{
+	}
+}
+
+uint32_t FRemoteEngine::GetRecievedReplicationFrameIndex() const
+{
+	return _recievedReplicationFrameIndex;
+}
+
+void FRemoteEngine::SetRecievedReplicationFrameIndex(uint32_t frameIndex)
+{
+	uint32_t current = _recievedReplicationFrameIndex;
+	while (current < frameIndex && !_recievedReplicationFrameIndex.compare_exchange_weak(current, frameIndex))
+	{
+	}
+}
+
+uint32_t FRemoteEngine::GetAcceptedCodecs() const
+{
+	return _acceptedCodecs;
+}
+
+void FRemoteEngine::SetAcceptedCodecs(uint32_t codecs)
+{
+	_acceptedCodecs = codecs;
+}
+
+void FRemoteEngine::SetClassSchemaMappings(std::vector<FClassSchemaMapping>&& classSchemaMappings)
+{
+	_classSchemaMappings = std::move(classSchemaMappings);
+}
+
+const FClassSchemaMapping* FRemoteEngine::FindClassSchemaMapping(uint16_t classID) const
+{
+	return classID < _classSchemaMappings.size() ? &_classSchemaMappings[classID] : nullptr;
+}
+
+bool FRemoteEngine::IsObjectHandleBound(const FObjectHandle& handle) const
+{
+	uint32_t index = handle.GetIndex();
+	if (index >= _objectHandleBindings.size())
+		return false;
+	const FObjectHandleBinding& binding = _objectHandleBindings[index];
+	// Remote engine acknowledges only completely applied frames, any frame since binding one carried it (binding frame is reset otherwise).
+	return binding.Handle == handle && binding.FrameIndex != 0 && binding.FrameIndex <= GetAcknowledgedReplicationFrameIndex();
+}
+
+void FRemoteEngine::SetObjectHandleBindingFrame(const FObjectHandle& handle, uint32_t frameIndex)
+{
+	uint32_t index = handle.GetIndex();
+	if (index >= _objectHandleBindings.size())
+	{
+		_objectHandleBindings.resize(index + 1, { FObjectHandle(), 0 });
+	}
+	FObjectHandleBinding& binding = _objectHandleBindings[index];
+	if (binding.Handle != handle || binding.FrameIndex == 0)
+	{
+		binding.Handle = handle;
+		binding.FrameIndex = frameIndex;
+	}
+}
+
+void FRemoteEngine::ResetObjectHandleBindingFrame(const FObjectHandle& handle)
+{
+	uint32_t index = handle.GetIndex();
+	if (index >= _objectHandleBindings.size())
+		return;
+	FObjectHandleBinding& binding = _objectHandleBindings[index];
+	if (binding.Handle == handle && !IsObjectHandleBound(handle))
+	{
+		binding.FrameIndex = 0;
+	}
+}
+
+FRemoteEngine::FObjectReplication& FRemoteEngine::GetObjectReplication(const FObjectHandle& handle)
+{
+	uint32_t index = handle.GetIndex();
+	if (index >= _objectReplications.size())
+	{
+		_objectReplications.resize(index + 1);
+	}
+	FObjectReplication& replication = _objectReplications[index];
+	if (replication.Handle != handle)
+	{
+		replication = FObjectReplication();
+		replication.Handle = handle;
+	}
+	return replication;
+}
+
+std::vector<FObjectHandle>& FRemoteEngine::GetRelevantObjectHandles()
+{
+	return _relevantObjectHandles;
+}
+
+void FRemoteEngine::BindRemoteObjectHandle(const FObjectHandle& remoteHandle, uint16_t remoteClassID, const FObjectHandle& localHandle)
+{
+	uint32_t index = remoteHandle.GetIndex();
+	if (index >= _remoteObjectHandleBindings.size())
+	{
+		_remoteObjectHandleBindings.resize(index + 1, { FObjectHandle(), 0, FObjectHandle() });
+	}
+	_remoteObjectHandleBindings[index] = { remoteHandle, remoteClassID, localHandle };
+}
+
+bool FRemoteEngine::FindRemoteObjectHandle(const FObjectHandle& remoteHandle, uint16_t& remoteClassID, FObjectHandle& localHandle) const
+{
+	uint32_t index = remoteHandle.GetIndex();
+	if (!remoteHandle.IsValid() || index >= _remoteObjectHandleBindings.size())
+		return false;
+	const FRemoteObjectHandleBinding& binding = _remoteObjectHandleBindings[index];
+	if (binding.RemoteHandle != remoteHandle)
+		return false;
+	remoteClassID = binding.RemoteClassID;
+	localHandle = binding.LocalHandle;
+	return true;
+}
+
 }
 }
\ No newline at end of file
@@ -37,6 +37,12 @@ public:
 	 */
 	void SetType(const std::string& type);
 
+	/**
+	 * @brief Set custom actor type name without copying.
+	 * @param type - custom actor type name to move from.
+	 */
+	void SetType(std::string&& type);
+
 protected:
 
 	GX_NETWORK_PROPERTY(std::string, Type);
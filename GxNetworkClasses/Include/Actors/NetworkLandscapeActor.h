@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../NetworkActor.h"
+#include "../NetworkHeightmapProperty.h"
 
 namespace gx {
 namespace network {
@@ -25,6 +26,21 @@ public:
 	 */
 	virtual ~FLandscapeActor();
 
+	/**
+	 * @brief See FObject::GetClassReplicationFrequency().
+	 */
+	virtual float GetClassReplicationFrequency() const override;
+
+	/**
+	 * @brief See FObject::GetReplicationPriority().
+	 */
+	virtual float GetReplicationPriority() const override;
+
+	/**
+	 * @brief See FObject::IsAlwaysRelevant().
+	 */
+	virtual bool IsAlwaysRelevant() const override;
+
 	/**
 	 * @brief Get heightmap width.
 	 * @return heightmap width.
@@ -65,8 +81,31 @@ public:
 	 * @brief Set heightmap data frame.
 	 * @param heightmap - heightmap data frame reference.
 	 */
+	void SetHeightmap(const std::vector<uint8_t>& heightmap);
+
+	/**
+	 * @brief Set heightmap data frame without copying.
+	 * @param heightmap - heightmap data frame to move from.
+	 */
 	void SetHeightmap(std::vector<uint8_t>&& heightmap);
 
+	/**
+	 * @brief Get scoped mutable access to heightmap data frame, heightmap is replicated after scope exit.
+	 * @return heightmap mutator.
+	 */
+	FPropertyMutator<std::vector<uint8_t>> MutateHeightmap();
+
+	/**
+	 * @brief Set heightmap region, only tiles covering the region are replicated again.
+	 * @param x - region left pixel.
+	 * @param y - region top pixel.
+	 * @param sizeX - region width.
+	 * @param sizeY - region height.
+	 * @param data - region data (row-major pixels of heightmap pixel size).
+	 * @return true on success, false - region is out of heightmap bounds or heightmap data does not match heightmap size.
+	 */
+	bool SetHeightmapRegion(uint32_t x, uint32_t y, uint32_t sizeX, uint32_t sizeY, const uint8_t* data);
+
 	/**
 	 * @brief Set heightmap pixel format.
 	 * @param heightmapPixelFormat - heightmap pixel format.
@@ -75,10 +114,11 @@ public:
 
 protected:
 
-	GX_NETWORK_PROPERTY(uint32_t, HeightmapSizeX, 0);
-	GX_NETWORK_PROPERTY(uint32_t, HeightmapSizeY, 0);
-	GX_NETWORK_PROPERTY(uint32_t, HeightmapPixelFormat, 0);
-	GX_NETWORK_PROPERTY(std::vector<uint8_t>, Heightmap, {});
+	GX_NETWORK_PROPERTY_PACKED(uint32_t, HeightmapSizeX, FVarIntPacker<uint32_t>, 0);
+	GX_NETWORK_PROPERTY_PACKED(uint32_t, HeightmapSizeY, FVarIntPacker<uint32_t>, 0);
+	GX_NETWORK_PROPERTY_PACKED(uint32_t, HeightmapPixelFormat, FVarIntPacker<uint32_t>, 0);
+	std::vector<uint8_t> Heightmap;
+	FHeightmapProperty PropertyHeightmap = FHeightmapProperty(this, "Heightmap", this->Heightmap, this->HeightmapSizeX, this->HeightmapSizeY);
 
 };
 
@@ -25,6 +25,11 @@ public:
 	 */
 	virtual ~FMobActor();
 
+	/**
+	 * @brief See FObject::GetReplicationPriority().
+	 */
+	virtual float GetReplicationPriority() const override;
+
 	/**
 	 * @brief Get mob velocity.
 	 * @return mob velocity.
@@ -51,8 +56,13 @@ public:
 
 protected:
 
+	/**
+	 * @brief Direction packer: unit vector, octahedral encoding, 10 bits per component.
+	 */
+	typedef FOctVec3fPacker<10> FDirectionPacker;
+
 	GX_NETWORK_PROPERTY(float, Velocity, 0.0f);
-	GX_NETWORK_PROPERTY(FVec3f, Direction, { 0.0f, 0.0f, 0.0f });
+	GX_NETWORK_PROPERTY_PACKED(FVec3f, Direction, FDirectionPacker, { 0.0f, 0.0f, 0.0f });
 
 };
 
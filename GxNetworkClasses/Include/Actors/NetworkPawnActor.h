@@ -25,6 +25,11 @@ public:
 	 */
 	virtual ~FPawnActor();
 
+	/**
+	 * @brief See FObject::GetReplicationPriority().
+	 */
+	virtual float GetReplicationPriority() const override;
+
 };
 
 }
@@ -25,6 +25,16 @@ public:
 	 */
 	virtual ~FTreeActor();
 
+	/**
+	 * @brief See FObject::GetClassReplicationFrequency().
+	 */
+	virtual float GetClassReplicationFrequency() const override;
+
+	/**
+	 * @brief See FObject::IsInitiallyDormant().
+	 */
+	virtual bool IsInitiallyDormant() const override;
+
 };
 
 }
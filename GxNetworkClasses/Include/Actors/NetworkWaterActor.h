@@ -25,6 +25,16 @@ public:
 	 */
 	virtual ~FWaterActor();
 
+	/**
+	 * @brief See FObject::GetClassReplicationFrequency().
+	 */
+	virtual float GetClassReplicationFrequency() const override;
+
+	/**
+	 * @brief See FObject::IsInitiallyDormant().
+	 */
+	virtual bool IsInitiallyDormant() const override;
+
 	/**
 	 * @brief Get water height.
 	 * @return water height.
@@ -65,8 +75,8 @@ protected:
 
 	GX_NETWORK_PROPERTY(float, WaterHeight, 0.0f);
 
-	GX_NETWORK_PROPERTY(uint32_t, HeightmapSizeX, 0);
-	GX_NETWORK_PROPERTY(uint32_t, HeightmapSizeY, 0);	
+	GX_NETWORK_PROPERTY_PACKED(uint32_t, HeightmapSizeX, FVarIntPacker<uint32_t>, 0);
+	GX_NETWORK_PROPERTY_PACKED(uint32_t, HeightmapSizeY, FVarIntPacker<uint32_t>, 0);	
 
 };
 
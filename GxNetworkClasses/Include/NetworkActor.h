@@ -44,15 +44,30 @@ public:
 	void SetScale(const FVec3f& scale);
 
 	/**
-	 * @brief Set actor location.
+	 * @brief Set actor location, actor is moved in engine spatial grid as well.
 	 * @param location - actor location.
 	 */
 	void SetLocation(const FVec3f& location);
 
 protected:
 
-	GX_NETWORK_PROPERTY(FVec3f, Scale,		{ 0.0f, 0.0f, 0.0f });
-	GX_NETWORK_PROPERTY(FVec3f, Location,	{ 0.0f, 0.0f, 0.0f });
+	/**
+	 * @brief See FObject::OnReplicated(). Actor is moved in engine spatial grid to replicated location.
+	 */
+	virtual void OnReplicated() override;
+
+	/**
+	 * @brief Scale packer: [-64, 64] range, 16 bits per component (~0.002 precision).
+	 */
+	typedef FFixedVec3fPacker<-64, 64, 16> FScalePacker;
+
+	/**
+	 * @brief Location packer: world bounds [-8192, 8192], 16 bits per component (0.25 precision).
+	 */
+	typedef FFixedVec3fPacker<-8192, 8192, 16> FLocationPacker;
+
+	GX_NETWORK_PROPERTY_PACKED(FVec3f, Scale,		FScalePacker,		{ 0.0f, 0.0f, 0.0f });
+	GX_NETWORK_PROPERTY_PACKED(FVec3f, Location,	FLocationPacker,	{ 0.0f, 0.0f, 0.0f });
 
 };
 
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "../../GxNetwork/Include/Engine/NetworkProperty.h"
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FHeightmapProperty class. Heightmap property serialized as tiles of FProperty::ChunkSize bytes,
+ * so in delta replication mode every tile is a chunk and only modified tiles are sent again (see FPropertyChunkWriter).
+ * Samples of tile rows are optionally delta encoded against the previous sample, so smooth terrain compresses better.
+ * Heightmaps not exceeding a single chunk or with pixel size not dividing chunk size are serialized as is.
+ */
+class GX_NETWORK_EXPORT FHeightmapProperty : public FVectorProperty
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 * @param object - owner object.
+	 * @param name - property name.
+	 * @param target - target heightmap data reference (row-major pixels).
+	 * @param sizeX - heightmap width reference.
+	 * @param sizeY - heightmap height reference.
+	 */
+	FHeightmapProperty(FObject* object, const char* name, std::vector<uint8_t>& target, const uint32_t& sizeX, const uint32_t& sizeY);
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FHeightmapProperty();
+
+	/**
+	 * @brief Set heightmap data and mark property dirty.
+	 * @param value - new heightmap data.
+	 */
+	void Set(const std::vector<uint8_t>& value);
+
+	/**
+	 * @brief Set heightmap data without copying and mark property dirty.
+	 * @param value - new heightmap data to move from.
+	 */
+	void Set(std::vector<uint8_t>&& value);
+
+	/**
+	 * @brief Get scoped mutable access to heightmap data, property is marked dirty on scope exit.
+	 * @return property mutator.
+	 */
+	FPropertyMutator<std::vector<uint8_t>> Mutate();
+
+	/**
+	 * @brief Set heightmap region pixels and mark property dirty, only tiles covering the region are sent again.
+	 * @param x - region left pixel.
+	 * @param y - region top pixel.
+	 * @param sizeX - region width.
+	 * @param sizeY - region height.
+	 * @param data - region data (row-major pixels of heightmap pixel size).
+	 * @return true on success, false - region is out of heightmap bounds or heightmap data does not match heightmap size.
+	 */
+	bool SetRegion(uint32_t x, uint32_t y, uint32_t sizeX, uint32_t sizeY, const uint8_t* data);
+
+	/**
+	 * @brief Get heightmap pixel size.
+	 * @return pixel size in bytes (0 - heightmap data does not match heightmap size).
+	 */
+	uint32_t GetPixelSize() const;
+
+	/**
+	 * @brief Enable delta encoding of tile samples (pixel sizes of 1, 2 and 4 bytes only).
+	 * @param bDeltaEncoding - delta encoding flag.
+	 */
+	void SetDeltaEncoding(bool bDeltaEncoding);
+
+	/**
+	 * @brief Check if delta encoding of tile samples is enabled.
+	 * @return true if delta encoding is enabled, false - otherwise.
+	 */
+	bool IsDeltaEncoding() const;
+
+	/**
+	 * @brief See FProperty::GetEncoding().
+	 */
+	virtual EPropertyEncoding GetEncoding() const override;
+
+	/**
+	 * @brief See FProperty::operator<<().
+	 */
+	virtual void operator<<(FIStream& stream) override;
+
+	/**
+	 * @brief See FProperty::operator>>().
+	 */
+	virtual void operator>>(FOStream& stream) const override;
+
+private:
+
+	enum : uint8_t { TiledHeightmapEncoding = static_cast<uint8_t>(EPropertyEncoding::Custom) };
+
+	static bool GetTileSize(uint32_t pixelSize, uint32_t& tileSizeX, uint32_t& tileSizeY);
+	static void EncodeDelta(uint8_t* row, uint32_t samplesCount, uint32_t sampleSize);
+	static void DecodeDelta(uint8_t* row, uint32_t samplesCount, uint32_t sampleSize);
+
+	std::vector<uint8_t>& _target;
+	const uint32_t& _sizeX;
+	const uint32_t& _sizeY;
+	bool _bDeltaEncoding = true;
+
+};
+
+}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../../GxNetwork/Include/Engine/NetworkRelevancy.h"
+#include "../../GxNetwork/Include/Engine/NetworkSpatialGrid.h"
+
+namespace gx {
+namespace network {
+
+/**
+ * @brief FDistanceRelevancyPolicy class. Actors are relevant within the given distance from the character of remote engine player
+ * (character GUID equals remote engine GUID, see FEngine::PlayerJoinGame()). Objects which are not actors are always relevant,
+ * actors are not relevant till player character exists. Actors stored in engine spatial grid are found with a single radius query per frame.
+ */
+class GX_NETWORK_EXPORT FDistanceRelevancyPolicy : public FRelevancyPolicy
+{
+
+public:
+
+	/**
+	 * @brief Constructor.
+	 * @param distance - relevancy distance.
+	 */
+	FDistanceRelevancyPolicy(float distance);
+
+	/**
+	 * @brief Destructor.
+	 */
+	virtual ~FDistanceRelevancyPolicy();
+
+	/**
+	 * @brief See FRelevancyPolicy::BeginFrame().
+	 */
+	virtual void BeginFrame(const FEngine& engine, const FRemoteEnginePtr& remoteEngine) override;
+
+	/**
+	 * @brief See FRelevancyPolicy::IsRelevant().
+	 */
+	virtual bool IsRelevant(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) override;
+
+	/**
+	 * @brief See FRelevancyPolicy::GatherCandidates(). Actors of the grid within relevancy distance of the viewer.
+	 */
+	virtual bool GatherCandidates(const FEngine& engine, const FRemoteEnginePtr& remoteEngine, std::vector<FObjectHandle>& handles) override;
+
+	/**
+	 * @brief See FRelevancyPolicy::GetPriorityScale(). Actors scale down linearly with distance to 1/4 at relevancy distance.
+	 */
+	virtual float GetPriorityScale(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine) override;
+
+	/**
+	 * @brief Get relevancy distance.
+	 * @return relevancy distance.
+	 */
+	float GetDistance() const;
+
+	/**
+	 * @brief Set relevancy distance.
+	 * @param distance - relevancy distance.
+	 */
+	void SetDistance(float distance);
+
+private:
+
+	bool IsMarked(const FObjectHandle& handle) const;
+
+	float _distance;
+
+	FObjectHandle _viewerHandle;
+	FVec3f _viewerLocation;
+
+	const FSpatialGrid* _spatialGrid = nullptr;
+	std::vector<FObjectHandle> _nearbyHandles;
+	// Frame mark by handle index, objects found by the last query carry the current mark.
+	std::vector<uint32_t> _marks;
+	uint32_t _mark = 0;
+
+};
+
+}
+}
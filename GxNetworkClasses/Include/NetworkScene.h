@@ -25,6 +25,11 @@ public:
 	 */
 	virtual ~FScene();
 
+	/**
+	 * @brief See FObject::IsAlwaysRelevant().
+	 */
+	virtual bool IsAlwaysRelevant() const override;
+
 };
 
 }
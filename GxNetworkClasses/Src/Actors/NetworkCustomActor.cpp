@@ -18,7 +18,12 @@ const std::string& FCustomActor::GetType() const
 
 void FCustomActor::SetType(const std::string& type)
 {
-	this->Type = type;
+	this->PropertyType.Set(type);
+}
+
+void FCustomActor::SetType(std::string&& type)
+{
+	this->PropertyType.Set(std::move(type));
 }
 
 }
@@ -11,6 +11,21 @@ FLandscapeActor::~FLandscapeActor()
 
 }
 
+bool FLandscapeActor::IsAlwaysRelevant() const
+{
+	return true;
+}
+
+float FLandscapeActor::GetReplicationPriority() const
+{
+	return 0.5f;
+}
+
+float FLandscapeActor::GetClassReplicationFrequency() const
+{
+	return 1.0f;
+}
+
 uint32_t FLandscapeActor::GetHeightmapSizeX() const
 {
 	return this->HeightmapSizeX;
@@ -33,22 +48,41 @@ const std::vector<uint8_t>& FLandscapeActor::GetHeightmap() const
 
 void FLandscapeActor::SetHeightmapSizeX(uint32_t heightmapSizeX)
 {
-	this->HeightmapSizeX = heightmapSizeX;
+	this->PropertyHeightmapSizeX.Set(heightmapSizeX);
+	// Heightmap tiles layout depends on heightmap size.
+	this->PropertyHeightmap.MarkDirty();
 }
 
 void FLandscapeActor::SetHeightmapSizeY(uint32_t heightmapSizeY)
 {
-	this->HeightmapSizeY = heightmapSizeY;
+	this->PropertyHeightmapSizeY.Set(heightmapSizeY);
+	// Heightmap tiles layout depends on heightmap size.
+	this->PropertyHeightmap.MarkDirty();
+}
+
+void FLandscapeActor::SetHeightmap(const std::vector<uint8_t>& heightmap)
+{
+	this->PropertyHeightmap.Set(heightmap);
 }
 
 void FLandscapeActor::SetHeightmap(std::vector<uint8_t>&& heightmap)
 {
-	this->Heightmap = heightmap;
+	this->PropertyHeightmap.Set(std::move(heightmap));
+}
+
+FPropertyMutator<std::vector<uint8_t>> FLandscapeActor::MutateHeightmap()
+{
+	return this->PropertyHeightmap.Mutate();
+}
+
+bool FLandscapeActor::SetHeightmapRegion(uint32_t x, uint32_t y, uint32_t sizeX, uint32_t sizeY, const uint8_t* data)
+{
+	return this->PropertyHeightmap.SetRegion(x, y, sizeX, sizeY, data);
 }
 
 void FLandscapeActor::SetHeightmapPixelFormat(uint32_t heightmapPixelFormat)
 {
-	this->HeightmapPixelFormat = heightmapPixelFormat;
+	this->PropertyHeightmapPixelFormat.Set(heightmapPixelFormat);
 }
 
 }
@@ -11,6 +11,11 @@ FMobActor::~FMobActor()
 
 }
 
+float FMobActor::GetReplicationPriority() const
+{
+	return 2.0f;
+}
+
 float FMobActor::GetVelocity() const
 {
 	return this->Velocity;
@@ -23,12 +28,12 @@ const FVec3f& FMobActor::GetDirection() const
 
 void FMobActor::SetVelocity(float velocity)
 {
-	this->Velocity = velocity;
+	this->PropertyVelocity.Set(velocity);
 }
 
 void FMobActor::SetDirection(const FVec3f& direction)
 {
-	this->Direction = direction;
+	this->PropertyDirection.Set(direction);
 }
 
 }
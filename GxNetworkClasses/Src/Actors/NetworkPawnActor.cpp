@@ -11,5 +11,10 @@ FPawnActor::~FPawnActor()
 
 }
 
+float FPawnActor::GetReplicationPriority() const
+{
+	return 3.0f;
+}
+
 }
 }
\ No newline at end of file
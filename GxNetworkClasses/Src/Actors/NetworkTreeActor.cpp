@@ -11,5 +11,15 @@ FTreeActor::~FTreeActor()
 
 }
 
+float FTreeActor::GetClassReplicationFrequency() const
+{
+	return 1.0f;
+}
+
+bool FTreeActor::IsInitiallyDormant() const
+{
+	return true;
+}
+
 }
 }
\ No newline at end of file
@@ -11,6 +11,16 @@ FWaterActor::~FWaterActor()
 
 }
 
+float FWaterActor::GetClassReplicationFrequency() const
+{
+	return 2.0f;
+}
+
+bool FWaterActor::IsInitiallyDormant() const
+{
+	return true;
+}
+
 float FWaterActor::GetWaterHeight() const
 {
 	return this->WaterHeight;
@@ -28,17 +38,17 @@ uint32_t FWaterActor::GetHeightmapSizeY() const
 
 void FWaterActor::SetWaterHeight(float waterHeight)
 {
-	this->WaterHeight = waterHeight;
+	this->PropertyWaterHeight.Set(waterHeight);
 }
 
 void FWaterActor::SetHeightmapSizeX(uint32_t heightmapSizeX)
 {
-	this->HeightmapSizeX = heightmapSizeX;
+	this->PropertyHeightmapSizeX.Set(heightmapSizeX);
 }
 
 void FWaterActor::SetHeightmapSizeY(uint32_t heightmapSizeY)
 {
-	this->HeightmapSizeY = heightmapSizeY;
+	this->PropertyHeightmapSizeY.Set(heightmapSizeY);
 }
 
 }
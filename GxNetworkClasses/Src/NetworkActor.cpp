@@ -23,12 +23,24 @@ const FVec3f& FActor::GetLocation() const
 
 void FActor::SetScale(const FVec3f& scale)
 {
-	this->Scale = scale;
+	this->PropertyScale.Set(scale);
 }
 
 void FActor::SetLocation(const FVec3f& location)
 {
-	this->Location = location;
+	this->PropertyLocation.Set(location);
+	if (GetHandle().IsValid())
+	{
+		_engine->GetSpatialGrid().Update(GetHandle(), location);
+	}
+}
+
+void FActor::OnReplicated()
+{
+	if (GetHandle().IsValid())
+	{
+		_engine->GetSpatialGrid().Update(GetHandle(), this->Location);
+	}
 }
 
 }
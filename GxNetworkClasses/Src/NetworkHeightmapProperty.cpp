@@ -0,0 +1,234 @@
+#include "../Include/NetworkHeightmapProperty.h"
+#include "../../GxNetwork/Include/Common/NetworkLog.h"
+
+#include <cstring>
+
+namespace gx {
+namespace network {
+
+FHeightmapProperty::FHeightmapProperty(FObject* object, const char* name, std::vector<uint8_t>& target, const uint32_t& sizeX, const uint32_t& sizeY)
+	: FVectorProperty(object, name, EType::UInt8)
+	, _target(target)
+	, _sizeX(sizeX)
+	, _sizeY(sizeY)
+{
+}
+
+FHeightmapProperty::~FHeightmapProperty()
+{
+}
+
+void FHeightmapProperty::Set(const std::vector<uint8_t>& value)
+{
+	_target = value;
+	MarkDirty();
+}
+
+void FHeightmapProperty::Set(std::vector<uint8_t>&& value)
+{
+	_target = std::move(value);
+	MarkDirty();
+}
+
+FPropertyMutator<std::vector<uint8_t>> FHeightmapProperty::Mutate()
+{
+	return FPropertyMutator<std::vector<uint8_t>>(*this, _target);
+}
+
+bool FHeightmapProperty::SetRegion(uint32_t x, uint32_t y, uint32_t sizeX, uint32_t sizeY, const uint8_t* data)
+{
+	uint32_t pixelSize = GetPixelSize();
+	if (pixelSize == 0 || x > _sizeX || sizeX > _sizeX - x || y > _sizeY || sizeY > _sizeY - y)
+		return false;
+	for (uint32_t row = 0; row < sizeY; ++row)
+	{
+		memcpy(_target.data() + (static_cast<size_t>(y + row) * _sizeX + x) * pixelSize, data + static_cast<size_t>(row) * sizeX * pixelSize, sizeX * pixelSize);
+	}
+	MarkDirty();
+	return true;
+}
+
+uint32_t FHeightmapProperty::GetPixelSize() const
+{
+	uint64_t pixelsCount = static_cast<uint64_t>(_sizeX) * _sizeY;
+	if (pixelsCount == 0 || _target.size() % pixelsCount != 0)
+		return 0;
+	return static_cast<uint32_t>(_target.size() / pixelsCount);
+}
+
+void FHeightmapProperty::SetDeltaEncoding(bool bDeltaEncoding)
+{
+	_bDeltaEncoding = bDeltaEncoding;
+	MarkDirty();
+}
+
+bool FHeightmapProperty::IsDeltaEncoding() const
+{
+	return _bDeltaEncoding;
+}
+
+EPropertyEncoding FHeightmapProperty::GetEncoding() const
+{
+	return static_cast<EPropertyEncoding>(TiledHeightmapEncoding);
+}
+
+// Heightmap semantic
+//
+// 1. Heightmap width			| varuint
+// 2. Heightmap height			| varuint
+// 3. Pixel size				| varuint (0 - heightmap is not tiled)
+// 4. Heightmap data			| std::vector<uint8_t> (not tiled only)
+// 4. Delta encoding			| bool (tiled only)
+// 5. Padding					| uint8_t[] (up to ChunkSize from property start, so tiles are chunk aligned)
+// 6. Tiles						| uint8_t[ChunkSize][] (row-major order, border tiles are padded with zeros)
+
+void FHeightmapProperty::operator<<(FIStream& stream)
+{
+	uint32_t startPos = stream.Pos();
+	uint32_t sizeX = stream.ReadVarUInt();
+	uint32_t sizeY = stream.ReadVarUInt();
+	uint32_t pixelSize = stream.ReadVarUInt();
+
+	uint32_t tileSizeX = 0;
+	uint32_t tileSizeY = 0;
+	if (!GetTileSize(pixelSize, tileSizeX, tileSizeY))
+	{
+		stream >> _target;
+		MarkDirty();
+		return;
+	}
+
+	bool bDeltaEncoding = false;
+	stream >> bDeltaEncoding;
+
+	// Sizes come from remote side, heightmap and its tiles are checked before allocation.
+	uint64_t size = static_cast<uint64_t>(sizeX) * sizeY * pixelSize;
+	uint64_t tilesCount = (static_cast<uint64_t>(sizeX) + tileSizeX - 1) / tileSizeX * ((static_cast<uint64_t>(sizeY) + tileSizeY - 1) / tileSizeY);
+	uint32_t headerSize = stream.Pos() - startPos;
+	if (size > MaxChunkedSize ||
+		(bDeltaEncoding && pixelSize > sizeof(uint32_t)) ||
+		headerSize > ChunkSize ||
+		tilesCount * ChunkSize + ChunkSize - headerSize > stream.Remaining())
+	{
+		FLogger::PrintWarning("Unable to replicate heightmap ", sizeX, "x", sizeY, ". Heightmap data is malformed.");
+		return;
+	}
+	stream.SetPos(startPos + ChunkSize);
+
+	_target.resize(static_cast<size_t>(size));
+	uint8_t tile[ChunkSize];
+	uint32_t tileRowSize = tileSizeX * pixelSize;
+	for (uint32_t tileY = 0; tileY < sizeY; tileY += tileSizeY)
+	{
+		for (uint32_t tileX = 0; tileX < sizeX; tileX += tileSizeX)
+		{
+			memcpy(tile, stream.Read(ChunkSize), ChunkSize);
+			uint32_t rowSize = (sizeX - tileX < tileSizeX ? sizeX - tileX : tileSizeX) * pixelSize;
+			for (uint32_t row = 0; row < tileSizeY && tileY + row < sizeY; ++row)
+			{
+				uint8_t* tileRow = tile + row * tileRowSize;
+				if (bDeltaEncoding)
+				{
+					DecodeDelta(tileRow, tileSizeX, pixelSize);
+				}
+				memcpy(_target.data() + (static_cast<size_t>(tileY + row) * sizeX + tileX) * pixelSize, tileRow, rowSize);
+			}
+		}
+	}
+	MarkDirty();
+}
+
+void FHeightmapProperty::operator>>(FOStream& stream) const
+{
+	uint32_t startPos = stream.Pos();
+	uint32_t pixelSize = GetPixelSize();
+	uint32_t tileSizeX = 0;
+	uint32_t tileSizeY = 0;
+	// Heightmap fitting a single chunk is not split anyway.
+	if (_target.size() <= ChunkSize || !GetTileSize(pixelSize, tileSizeX, tileSizeY))
+	{
+		pixelSize = 0;
+	}
+
+	stream.WriteVarUInt(_sizeX);
+	stream.WriteVarUInt(_sizeY);
+	stream.WriteVarUInt(pixelSize);
+	if (pixelSize == 0)
+	{
+		stream << _target;
+		return;
+	}
+
+	bool bDeltaEncoding = _bDeltaEncoding && pixelSize <= sizeof(uint32_t);
+	stream << bDeltaEncoding;
+	while (stream.Pos() - startPos < ChunkSize)
+	{
+		stream << static_cast<uint8_t>(0);
+	}
+
+	uint8_t tile[ChunkSize];
+	uint32_t tileRowSize = tileSizeX * pixelSize;
+	for (uint32_t tileY = 0; tileY < _sizeY; tileY += tileSizeY)
+	{
+		for (uint32_t tileX = 0; tileX < _sizeX; tileX += tileSizeX)
+		{
+			memset(tile, 0, ChunkSize);
+			uint32_t rowSize = (_sizeX - tileX < tileSizeX ? _sizeX - tileX : tileSizeX) * pixelSize;
+			for (uint32_t row = 0; row < tileSizeY && tileY + row < _sizeY; ++row)
+			{
+				uint8_t* tileRow = tile + row * tileRowSize;
+				memcpy(tileRow, _target.data() + (static_cast<size_t>(tileY + row) * _sizeX + tileX) * pixelSize, rowSize);
+				if (bDeltaEncoding)
+				{
+					EncodeDelta(tileRow, tileSizeX, pixelSize);
+				}
+			}
+			stream.Write(tile, ChunkSize);
+		}
+	}
+}
+
+bool FHeightmapProperty::GetTileSize(uint32_t pixelSize, uint32_t& tileSizeX, uint32_t& tileSizeY)
+{
+	// Tile is a single chunk, so pixel size should be a power of two.
+	if (pixelSize == 0 || pixelSize > ChunkSize || (pixelSize & (pixelSize - 1)) != 0)
+		return false;
+	uint32_t tilePixelsCount = ChunkSize / pixelSize;
+	tileSizeX = 1;
+	while (tileSizeX * tileSizeX < tilePixelsCount)
+	{
+		tileSizeX *= 2;
+	}
+	tileSizeY = tilePixelsCount / tileSizeX;
+	return true;
+}
+
+void FHeightmapProperty::EncodeDelta(uint8_t* row, uint32_t samplesCount, uint32_t sampleSize)
+{
+	// Samples are little-endian unsigned integers, differences wrap around.
+	for (uint32_t i = samplesCount - 1; i > 0; --i)
+	{
+		uint32_t sample = 0;
+		uint32_t previousSample = 0;
+		memcpy(&sample, row + i * sampleSize, sampleSize);
+		memcpy(&previousSample, row + (i - 1) * sampleSize, sampleSize);
+		sample -= previousSample;
+		memcpy(row + i * sampleSize, &sample, sampleSize);
+	}
+}
+
+void FHeightmapProperty::DecodeDelta(uint8_t* row, uint32_t samplesCount, uint32_t sampleSize)
+{
+	for (uint32_t i = 1; i < samplesCount; ++i)
+	{
+		uint32_t sample = 0;
+		uint32_t previousSample = 0;
+		memcpy(&sample, row + i * sampleSize, sampleSize);
+		memcpy(&previousSample, row + (i - 1) * sampleSize, sampleSize);
+		sample += previousSample;
+		memcpy(row + i * sampleSize, &sample, sampleSize);
+	}
+}
+
+}
+}
@@ -0,0 +1,113 @@
+#include "../Include/NetworkRelevancy.h"
+#include "../Include/NetworkActor.h"
+#include "../../GxNetwork/Include/Engine/NetworkEngine.h"
+#include "../../GxNetwork/Include/Network/NetworkRemoteEngine.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gx {
+namespace network {
+
+FDistanceRelevancyPolicy::FDistanceRelevancyPolicy(float distance)
+	: _distance(distance)
+{
+
+}
+
+FDistanceRelevancyPolicy::~FDistanceRelevancyPolicy()
+{
+
+}
+
+void FDistanceRelevancyPolicy::BeginFrame(const FEngine& engine, const FRemoteEnginePtr& remoteEngine)
+{
+	FObjectPtr viewer = engine.GetObjectByGUID(remoteEngine->GetGUID());
+	const FActor* viewerActor = dynamic_cast<const FActor*>(viewer.get());
+	_viewerHandle = viewerActor ? viewerActor->GetHandle() : FObjectHandle();
+	_viewerLocation = viewerActor ? viewerActor->GetLocation() : FVec3f();
+
+	_spatialGrid = &engine.GetSpatialGrid();
+	if (++_mark == 0)
+	{
+		std::fill(_marks.begin(), _marks.end(), 0);
+		_mark = 1;
+	}
+
+	_nearbyHandles.clear();
+	if (_viewerHandle.IsValid())
+	{
+		_spatialGrid->QueryRadius(_viewerLocation, _distance, _nearbyHandles);
+		for (const FObjectHandle& handle : _nearbyHandles)
+		{
+			if (handle.GetIndex() >= _marks.size())
+			{
+				_marks.resize(handle.GetIndex() + 1, 0);
+			}
+			_marks[handle.GetIndex()] = _mark;
+		}
+	}
+}
+
+bool FDistanceRelevancyPolicy::IsRelevant(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine)
+{
+	const FObjectHandle& handle = object->GetHandle();
+
+	// Located actors are answered by the grid query, others are checked one by one.
+	if (_spatialGrid && _spatialGrid->Contains(handle))
+		return _viewerHandle.IsValid() && (handle == _viewerHandle || IsMarked(handle));
+
+	const FActor* actor = dynamic_cast<const FActor*>(object.get());
+	if (!actor)
+		return true;
+
+	if (!_viewerHandle.IsValid())
+		return false;
+
+	if (handle == _viewerHandle)
+		return true;
+
+	const FVec3f& location = actor->GetLocation();
+	float dx = location.x - _viewerLocation.x;
+	float dy = location.y - _viewerLocation.y;
+	float dz = location.z - _viewerLocation.z;
+	return dx * dx + dy * dy + dz * dz <= _distance * _distance;
+}
+
+bool FDistanceRelevancyPolicy::GatherCandidates(const FEngine& engine, const FRemoteEnginePtr& remoteEngine, std::vector<FObjectHandle>& handles)
+{
+	handles.insert(handles.end(), _nearbyHandles.begin(), _nearbyHandles.end());
+	return true;
+}
+
+float FDistanceRelevancyPolicy::GetPriorityScale(const FObjectPtr& object, const FRemoteEnginePtr& remoteEngine)
+{
+	const FActor* actor = dynamic_cast<const FActor*>(object.get());
+	if (!actor || !_viewerHandle.IsValid() || _distance <= 0.0f)
+		return 1.0f;
+
+	const FVec3f& location = actor->GetLocation();
+	float dx = location.x - _viewerLocation.x;
+	float dy = location.y - _viewerLocation.y;
+	float dz = location.z - _viewerLocation.z;
+	float distance = std::sqrt(dx * dx + dy * dy + dz * dz) / _distance;
+	return 1.0f - 0.75f * (distance < 1.0f ? distance : 1.0f);
+}
+
+float FDistanceRelevancyPolicy::GetDistance() const
+{
+	return _distance;
+}
+
+void FDistanceRelevancyPolicy::SetDistance(float distance)
+{
+	_distance = distance;
+}
+
+bool FDistanceRelevancyPolicy::IsMarked(const FObjectHandle& handle) const
+{
+	return handle.GetIndex() < _marks.size() && _marks[handle.GetIndex()] == _mark;
+}
+
+}
+}
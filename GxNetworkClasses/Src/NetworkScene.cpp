@@ -11,5 +11,10 @@ FScene::~FScene()
 
 }
 
+bool FScene::IsAlwaysRelevant() const
+{
+	return true;
+}
+
 }
 }
\ No newline at end of file